@@ -1,6 +1,6 @@
 /*              Author: Michael Marven
  *        Date Created: 05/30/17
- *  Date Last Modified: 06/03/17
+ *  Date Last Modified: 10/17/26
  *
  */
 
@@ -58,84 +58,68 @@ void KnightGraph::dfsPathFind(int start_x, int start_y, int end_x, int end_y)
     }
 }
 
-/* Algorithm - Mark current node visited
- *           - Add current node to m_path
- *           - Check if current node is the end node; If so, return (base case)
- *           - Get the legal moves available from the current node
- *           - Check for the first node of the returned list of moves that has 
- *             not been visited
- *           - If no unvisited legal moves exist, set next_x and next_y to 
- *             previous node visited
- *           - Otherwise, set next_x and next_y to the next unvisited legal move
- *           - Visit next_x and next_y (recursive call)
+/* Algorithm - Mark the start node visited and add it to m_path
+ *           - While m_path contains nodes:
+ *             - Check if the node at the back of m_path is the end node; If 
+ *               so, return
+ *             - Get the legal moves available from the back node
+ *             - Check for the first node of the returned list of moves that has
+ *               not been visited
+ *             - If no unvisited legal moves exist, pop the back node off m_path
+ *               to move back to the previous node
+ *             - Otherwise, mark the next unvisited legal move visited and add 
+ *               it to m_path
+ *
+ * Note      - m_path is the DFS stack, so no recursion is needed and the depth
+ *             of the search is not limited by the call stack
+ *           - Vertex numbers index m_nodes directly
+ *           - If the end node cannot be reached, m_path is left empty
  * 
  */
 void KnightGraph::visitNext(int start_x, int start_y, int end_x, int end_y)
 {
-    // Create Vertex for current node
-    Vertex current_node(start_x, start_y);
+    // Mark start node visited and add to m_path
+    Vertex start_node(start_x, start_y);
+    m_nodes[start_node.number].visited = true;
+    m_path.push_back(start_node);
 
-    // Mark current node visited and add to m_path
-    auto result = std::find_if(
-        std::begin(m_nodes), std::end(m_nodes), match_num(current_node.number));
-    if (result != std::end(m_nodes))
-    {
-        result->visited = true;
-        m_path.push_back(current_node);
-    }
-    
-    // Check if current node position equals end node and if so, return
-    if (start_x == end_x && start_y == end_y)
+    while (!m_path.empty())
     {
-        return;
-    }
-
-    // Get available legal moves
-    std::vector<Vertex> legal_moves = m_validator->getLegalMoves(current_node);
+        Vertex current_node = m_path.back();
 
-    // Check for first unvisited legal move
-    int position = -1;
-    for (unsigned int i = 0; i < legal_moves.size(); i++)
-    {
-        auto result = std::find_if(
-            std::begin(m_nodes), std::end(m_nodes), 
-            match_num(legal_moves[i].number));
-        if ((result != std::end(m_nodes)) && !result->visited)
+        // Check if current node position equals end node and if so, return
+        if (current_node.x == end_x && current_node.y == end_y)
         {
-            position = i;
-            i = legal_moves.size();
+            return;
         }
-    }
-
-    // Determine next node
-    int next_x = -1;
-    int next_y = -1;
-
-    if (position != -1)
-    {
-        next_x = legal_moves[position].x;
-        next_y = legal_moves[position].y;
-    }
-    else
-    {
-        // No unvisited legal moves exist; Move back one node and check for move
 
-        // Pop current node off path
-        m_path.pop_back();
+        // Get available legal moves
+        std::vector<Vertex> legal_moves = 
+            m_validator->getLegalMoves(current_node);
 
-        if (!m_path.empty())
+        // Check for first unvisited legal move
+        int position = -1;
+        for (unsigned int i = 0; i < legal_moves.size(); i++)
         {
-            // Retrieves coordinates of previous node
-            next_x = m_path.back().x;
-            next_y = m_path.back().y;
+            if (!m_nodes[legal_moves[i].number].visited)
+            {
+                position = i;
+                i = legal_moves.size();
+            }
         }
 
-        // Pop previous node off path so it is not added twice
-        m_path.pop_back();
+        if (position != -1)
+        {
+            // Mark next node visited and add to m_path
+            m_nodes[legal_moves[position].number].visited = true;
+            m_path.push_back(legal_moves[position]);
+        }
+        else
+        {
+            // No unvisited legal moves exist; Move back one node
+            m_path.pop_back();
+        }
     }
-
-    // Visit next node
-    visitNext(next_x, next_y, end_x, end_y);
 }
 
 /* Algorithm - Return m_path
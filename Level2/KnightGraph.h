@@ -3,7 +3,7 @@
 
 /*              Author: Michael Marven
  *        Date Created: 05/30/17
- *  Date Last Modified: 06/03/17
+ *  Date Last Modified: 10/17/26
  *
  */
 
@@ -42,8 +42,8 @@ public:
 
 private:
 
-    /* Brief desc.       - A recursive method to visit nodes and build the path 
-     *                     to the end node
+    /* Brief desc.       - A method to visit nodes and build the path to the end
+     *                     node, using m_path as an explicit DFS stack
      * param[in] start_x - X coordinate of the starting node
      * param[in] start_y - Y coordinate of the starting node
      * param[in] end_x   - X coordinate of the ending node
@@ -1,6 +1,6 @@
 /*              Author: Michael Marven
  *        Date Created: 05/30/17
- *  Date Last Modified: 06/04/17
+ *  Date Last Modified: 10/17/26
  *
  */
 
@@ -45,7 +45,7 @@ KnightGraph::~KnightGraph()
  *             matrix until a point is reached where a move to an unvisited node
  *             is not possible
  *           - Check m_nodes for the first unvisited node and begin DFS again 
- *             from that node
+ *             from that node, until no unvisited nodes remain
  * 
  */
 void KnightGraph::dfsGraphBuild(int start_x, int start_y)
@@ -65,23 +65,15 @@ void KnightGraph::dfsGraphBuild(int start_x, int start_y)
         return;
     }
 
-    // Get number of unvisited nodes remaining
-    auto unvisited_nodes = std::count_if(m_nodes.begin(), m_nodes.end(), 
-            match_visited(false));
-
-    // Visit remaining unvisited nodes
-    while (unvisited_nodes != 0)
+    // Visit remaining unvisited nodes; Nodes only become visited, so the scan
+    // for the first unvisited node continues from the last one found
+    for (unsigned int i = 0; i < m_nodes.size(); i++)
     {
-        // Find first unvisited node
-        auto result = std::find_if(
-        m_nodes.begin(), m_nodes.end(), match_visited(false));
-
-        // Start DFS from the first unvisited node
-        dfsVisitNext(result->x, result->y);
-
-        // Get number of unvisited nodes remaining
-        unvisited_nodes = std::count_if(m_nodes.begin(), m_nodes.end(), 
-            match_visited(false));
+        if (!m_nodes[i].visited)
+        {
+            // Start DFS from the first unvisited node
+            dfsVisitNext(m_nodes[i].x, m_nodes[i].y);
+        }
     }
 
     // Reset visited status for all nodes
@@ -185,69 +177,58 @@ void KnightGraph::bfsShortestPath(int start_x, int start_y,
     std::reverse(m_path.begin(), m_path.end());
 }
 
-/* Algorithm - Mark current node visited
- *           - Get the legal moves available from the current node
- *           - Add node connections to adjancency matrix
- *           - Check for the first node of the returned list of moves that has 
- *             not been visited
- *           - If no unvisited legal moves exist, return (base case)
- *           - Otherwise, set next_x and next_y to the next unvisited legal move
- *           - Visit next_x and next_y (recursive call)
+/* Algorithm - Mark the start node visited
+ *           - Loop from the current node:
+ *             - Get the legal moves available from the current node
+ *             - Add node connections to adjancency matrix
+ *             - Check for the first node of the returned list of moves that has
+ *               not been visited
+ *             - If no unvisited legal moves exist, return
+ *             - Otherwise, mark the next unvisited legal move visited and make 
+ *               it the current node
+ *
+ * Note      - Vertex numbers index m_nodes directly
  * 
  */
 void KnightGraph::dfsVisitNext(int start_x, int start_y)
 {
-    // Create Vertex for current node
+    // Create Vertex for current node and mark it visited
     Vertex current_node(start_x, start_y);
+    m_nodes[current_node.number].visited = true;
 
-    // Mark current node visited
-    auto result = std::find_if(
-        m_nodes.begin(), m_nodes.end(), match_num(current_node.number));
-    if (result != m_nodes.end())
+    while (true)
     {
-        result->visited = true;
-    }
+        // Get available legal moves
+        std::vector<Vertex> legal_moves = 
+            m_validator->getLegalMoves(current_node);
 
-    // Get available legal moves
-    std::vector<Vertex> legal_moves = m_validator->getLegalMoves(current_node);
-
-    // Add node connections to adjancency matrix
-    for (unsigned int i = 0; i < legal_moves.size(); i++)
-    {
-        m_adj_matrix[current_node.number][legal_moves[i].number] = 1;
-    }
-
-    // Check for first unvisited legal move
-    int position = -1;
-    for (unsigned int i = 0; i < legal_moves.size(); i++)
-    {
-        auto result = std::find_if(m_nodes.begin(), m_nodes.end(), 
-            match_num(legal_moves[i].number));
-        if ((result != m_nodes.end()) && !result->visited)
+        // Add node connections to adjancency matrix
+        for (unsigned int i = 0; i < legal_moves.size(); i++)
         {
-            position = i;
-            i = legal_moves.size();
+            m_adj_matrix[current_node.number][legal_moves[i].number] = 1;
         }
-    }
 
-    // Determine next node
-    int next_x = -1;
-    int next_y = -1;
+        // Check for first unvisited legal move
+        int position = -1;
+        for (unsigned int i = 0; i < legal_moves.size(); i++)
+        {
+            if (!m_nodes[legal_moves[i].number].visited)
+            {
+                position = i;
+                i = legal_moves.size();
+            }
+        }
 
-    if (position != -1)
-    {
-        next_x = legal_moves[position].x;
-        next_y = legal_moves[position].y;
-    }
-    else
-    {
-        // No unvisited legal moves exist; Return
+        if (position == -1)
+        {
+            // No unvisited legal moves exist; Return
+            return;
+        }
 
-        return;
+        // Mark next node visited and make it the current node
+        current_node = legal_moves[position];
+        m_nodes[current_node.number].visited = true;
     }
-
-    // Visit next node
-    dfsVisitNext(next_x, next_y);
 }
 
 /* Algorithm - Return m_path
@@ -3,7 +3,7 @@
 
 /*              Author: Michael Marven
  *        Date Created: 05/30/17
- *  Date Last Modified: 06/04/17
+ *  Date Last Modified: 10/17/26
  *
  */
 
@@ -53,8 +53,8 @@ public:
 
 private:
 
-    /* Brief desc.       - A recursive method to visit nodes and build the
-     *                     adjacency matrix
+    /* Brief desc.       - A method to visit nodes and build the adjacency 
+     *                     matrix
      * param[in] start_x - X coordinate of the starting node
      * param[in] start_y - Y coordinate of the starting node
      *
@@ -1,6 +1,6 @@
 /*              Author: Michael Marven
  *        Date Created: 05/26/17
- *  Date Last Modified: 06/04/17
+ *  Date Last Modified: 10/17/26
  *
  */
 
@@ -212,9 +212,8 @@ void MoveValidator::printBoard(std::vector<std::vector<char> > board)
  *             destination must not be located beyond the edge of the board
  * 
  */
-bool MoveValidator::checkMove(
-        Vertex origin, 
-        Vertex destination)
+bool MoveValidator::checkMove(const Vertex &origin, 
+    const Vertex &destination)
 {
     // Check if move is valid
     bool is_valid_shape   = false;
@@ -243,8 +242,8 @@ bool MoveValidator::checkMove(
         is_valid_shape = true;
     }
 
-    // Check if destination is beyond the edge of the board
-    if (onBoard(destination))
+    // Check if origin or destination is beyond the edge of the board
+    if (onBoard(origin) && onBoard(destination))
     {
         dest_on_board = true;
     }
@@ -257,19 +256,50 @@ bool MoveValidator::checkMove(
     return tests_passed;
 }
 
-/* Algorithm - Call validateMoves() to verify legality of move
+/* Algorithm - Call checkMove() to verify legality of move
+ * 
+ * Note      - The board is not marked and no move set is built, so the check
+ *             does not allocate memory
  * 
  */
-bool MoveValidator::isLegalMove(Vertex start, Vertex end)
+bool MoveValidator::isLegalMove(const Vertex &start, const Vertex &end)
 {
-    // Check legality of move
-    bool print_board = false;
-    std::vector<Vertex> move;
-    
-    move.push_back(start);
-    move.push_back(end);
+    return checkMove(start, end);
+}
+
+/* Algorithm - Build the start and end Vertex structs on the stack and call 
+ *             checkMove() to verify legality of move
+ * 
+ */
+bool MoveValidator::isLegalMove(int start_x, int start_y, int end_x, int end_y)
+{
+    Vertex start(start_x, start_y);
+    Vertex end(end_x, end_y);
+
+    return checkMove(start, end);
+}
+
+/* Algorithm - Return false for an empty move set, as validateMoves() does
+ *           - Call checkMove() for each pair of consecutive moves and return 
+ *             false at the first invalid move
+ * 
+ */
+bool MoveValidator::areLegalMoves(const std::vector<Vertex> &moves)
+{
+    if (moves.empty())
+    {
+        return false;
+    }
+
+    for (unsigned int i = 0; i + 1 < moves.size(); i++)
+    {
+        if (!checkMove(moves[i], moves[i + 1]))
+        {
+            return false;
+        }
+    }
 
-    return (validateMoves(move, print_board));
+    return true;
 }
 
 
@@ -1,6 +1,6 @@
 /*              Author: Michael Marven
  *        Date Created: 05/30/17
- *  Date Last Modified: 06/26/17
+ *  Date Last Modified: 10/17/26
  *
  */
 
@@ -41,6 +41,7 @@ KnightGraph::~KnightGraph()
 }
 
 /* Algorithm - Confirm that the start node is on the board
+ *           - Clear the visited status left in m_nodes by an earlier search
  *           - Call dfsVisitNext() to use a DFS to build the adjacency matrix 
  *           - Reset the visited status for all nodes in m_nodes
  * 
@@ -57,6 +58,12 @@ void KnightGraph::dfsGraphBuild(int start_x, int start_y)
         return;
     }
 
+    // Clear visited status left by an earlier search
+    for (unsigned int i = 0; i < m_nodes.size(); i++)
+    {
+        m_nodes[i].visited = false;
+    }
+
     // Call visitNext() to use DFS to build adjacency matrix
     dfsVisitNext(start_x, start_y);
 
@@ -83,16 +90,16 @@ void KnightGraph::dfsGraphBuild(int start_x, int start_y)
 void KnightGraph::bfsShortestPath(int start_x, int start_y, 
     int end_x, int end_y)
 {
-    // Verify start and end Vertex structs are on board    
-    Vertex start(start_x, start_y, m_board_row_size);    
+    // Verify start and end Vertex structs are on board    
+    Vertex start(start_x, start_y, m_board_row_size);    
     Vertex end(end_x, end_y, m_board_row_size);
     
-    bool start_is_on_board = m_validator->isOnBoard(start);    
-    bool end_is_on_board   = m_validator->isOnBoard(end);
-    if (!start_is_on_board || !end_is_on_board)    
-    {        
+    bool start_is_on_board = m_validator->isOnBoard(start);    
+    bool end_is_on_board   = m_validator->isOnBoard(end);
+    if (!start_is_on_board || !end_is_on_board)    
+    {        
         std::cout << "Start or end node is invalid.\n";
-        return;    
+        return;    
     }
     
     // Build the adjacency matrix
@@ -200,9 +207,9 @@ void KnightGraph::daShortestPath(int start_x, int start_y, int end_x, int end_y)
     bool start_is_on_board = m_validator->isOnBoard(start);
     bool end_is_on_board   = m_validator->isOnBoard(end);
     bool start_is_rock     = m_validator->isRock(start);
-    bool end_is_rock       = m_validator->isRock(end);
-    bool start_is_barrier  = m_validator->isBarrier(start);    
-    bool end_is_barrier    = m_validator->isBarrier(end);
+    bool end_is_rock       = m_validator->isRock(end);
+    bool start_is_barrier  = m_validator->isBarrier(start);    
+    bool end_is_barrier    = m_validator->isBarrier(end);
 
     if (!start_is_on_board || !end_is_on_board || start_is_rock || end_is_rock 
         || start_is_barrier || end_is_barrier)
@@ -308,124 +315,115 @@ void KnightGraph::daShortestPath(int start_x, int start_y, int end_x, int end_y)
     std::reverse(m_path.begin(), m_path.end());
 }
 
-/* Algorithm - Mark current node visited and add to m_path
- *           - Get the legal moves available from the current node
- *           - Add node connections to adjancency matrix
- *           - Check for the first node of the returned list of moves that has 
- *             not been visited
- *           - If no unvisited legal moves exist, move back one node and check 
- *             for unvisited nodes
- *           - If beginning of path has been reached and no unvisited nodes 
- *             exist, return (base case)
- *           - Otherwise, set next_x and next_y to the next unvisited legal move
- *           - Visit next_x and next_y (recursive call)
+/* Algorithm - Mark the start node visited and add it to m_path
+ *           - While m_path contains nodes:
+ *             - Get the legal moves available from the node at the back of 
+ *               m_path
+ *             - Add node connections to adjancency matrix
+ *             - Replace each teleport node in the list of moves with the other
+ *               teleport node
+ *             - Check for the first node of the returned list of moves that has
+ *               not been visited
+ *             - If no unvisited legal moves exist, pop the back node off m_path
+ *               to move back to the previous node; Once m_path is empty, the 
+ *               graph has been fully explored
+ *             - Otherwise, mark the next unvisited legal move visited and add 
+ *               it to m_path
+ *
+ * Note      - m_path is the DFS stack, so no recursion is needed and the depth
+ *             of the search is not limited by the call stack
+ *           - Vertex numbers index m_nodes directly
  * 
  */
 void KnightGraph::dfsVisitNext(int start_x, int start_y)
 {
-    // Create Vertex for current node
-    Vertex current_node(start_x, start_y, m_board_row_size);
+    // Mark start node visited and add to m_path
+    Vertex start_node(start_x, start_y, m_board_row_size);
+    m_nodes[start_node.number].visited = true;
+    m_path.push_back(start_node);
 
-    // Mark current node visited and add to m_path
-    auto result = std::find_if(
-        m_nodes.begin(), m_nodes.end(), match_num(current_node.number));
-    if (result != m_nodes.end())
+    while (!m_path.empty())
     {
-        result->visited = true;
-        m_path.push_back(current_node);
-    }
-
-    // Get available legal moves
-    std::vector<Vertex> legal_moves = m_validator->getLegalMoves(current_node);
+        Vertex current_node = m_path.back();
 
-    // Add node connections to adjancency matrix
-    for (unsigned int i = 0; i < legal_moves.size(); i++)
-    {
-        // Get the node tyoe of the legal move node
-        char node_type = m_board[legal_moves[i].y][legal_moves[i].x];
+        // Get available legal moves
+        std::vector<Vertex> legal_moves = 
+            m_validator->getLegalMoves(current_node);
 
-        // Determine what the edge weight will be for the adj matrix connection
-        switch(node_type)
+        // Add node connections to adjancency matrix
+        for (unsigned int i = 0; i < legal_moves.size(); i++)
         {
-            case 'W':
-            {
-                m_adj_matrix[current_node.number][legal_moves[i].number] 
-                    = WATER_NODE_WEIGHT;
-                break;
-            }
-            case 'L':
-            {
-                m_adj_matrix[current_node.number][legal_moves[i].number] 
-                    = LAVA_NODE_WEIGHT;
-                break;
-            }
-            case 'T': // Teleport node - connect to other teleport node
+            // Get the node tyoe of the legal move node
+            char node_type = m_board[legal_moves[i].y][legal_moves[i].x];
+
+            // Determine what the edge weight will be for the adj matrix 
+            // connection
+            switch(node_type)
             {
-                // Retrieve other T node number
-                Vertex teleport_node = 
-                    m_validator->getTeleportNode(legal_moves[i]);
-                // Add connection to retrieved node in matrix rather than 
-                // current T node from legal_moves
-                m_adj_matrix[current_node.number][teleport_node.number] = 1;
-                break;
+                case 'W':
+                {
+                    m_adj_matrix[current_node.number][legal_moves[i].number] 
+                        = WATER_NODE_WEIGHT;
+                    break;
+                }
+                case 'L':
+                {
+                    m_adj_matrix[current_node.number][legal_moves[i].number] 
+                        = LAVA_NODE_WEIGHT;
+                    break;
+                }
+                case 'T': // Teleport node - connect to other teleport node
+                {
+                    // Retrieve other T node number
+                    Vertex teleport_node = 
+                        m_validator->getTeleportNode(legal_moves[i]);
+                    // Add connection to retrieved node in matrix rather than 
+                    // current T node from legal_moves
+                    m_adj_matrix[current_node.number][teleport_node.number] 
+                        = 1;
+                    break;
+                }
+                default: // '.' character - normal node
+                {
+                    m_adj_matrix[current_node.number][legal_moves[i].number] 
+                        = 1;
+                }
             }
-            default: // '.' character - normal node
+        }
+
+        // A move onto a teleport node lands on the other teleport node, as the
+        // adjacency matrix connects it
+        for (unsigned int i = 0; i < legal_moves.size(); i++)
+        {
+            if (m_board[legal_moves[i].y][legal_moves[i].x] == 'T')
             {
-                m_adj_matrix[current_node.number][legal_moves[i].number] = 1;
+                legal_moves[i] = m_validator->getTeleportNode(legal_moves[i]);
             }
         }
 
-    }
-
-    // Check for first unvisited legal move
-    int position = -1;
-    for (unsigned int i = 0; i < legal_moves.size(); i++)
-    {
-        auto result = std::find_if(m_nodes.begin(), m_nodes.end(), 
-            match_num(legal_moves[i].number));
-        if ((result != m_nodes.end()) && !result->visited)
+        // Check for first unvisited legal move
+        int position = -1;
+        for (unsigned int i = 0; i < legal_moves.size(); i++)
         {
-            position = i;
-            i = legal_moves.size();
+            if (!m_nodes[legal_moves[i].number].visited)
+            {
+                position = i;
+                i = legal_moves.size();
+            }
         }
-    }
-
-    // Determine next node
-    int next_x = -1;
-    int next_y = -1;
-
-    if (position != -1)
-    {
-        next_x = legal_moves[position].x;
-        next_y = legal_moves[position].y;
-    }
-    else
-    {
-        // No unvisited legal moves exist; Move back one node and check for move
-
-        // Pop current node off path
-        m_path.pop_back();
 
-        if (!m_path.empty())
+        if (position != -1)
         {
-            // Retrieves coordinates of previous node
-            next_x = m_path.back().x;
-            next_y = m_path.back().y;
+            // Mark next node visited and add to m_path
+            m_nodes[legal_moves[position].number].visited = true;
+            m_path.push_back(legal_moves[position]);
         }
         else
         {
-            // The path is empty after popping the current node off; The graph
-            // has been fully explored
-
-            return;
+            // No unvisited legal moves exist; Move back one node
+            m_path.pop_back();
         }
-
-        // Pop previous node off path so it is not added twice
-        m_path.pop_back();
     }
-
-    // Visit next node
-    dfsVisitNext(next_x, next_y);
 }
 
 /* Algorithm - Return m_path
@@ -3,7 +3,7 @@
 
 /*              Author: Michael Marven
  *        Date Created: 05/30/17
- *  Date Last Modified: 06/25/17
+ *  Date Last Modified: 10/17/26
  *
  */
 
@@ -63,8 +63,8 @@ public:
 
 private:
 
-    /* Brief desc.       - A recursive method to visit nodes and build the
-     *                     adjacency matrix
+    /* Brief desc.       - A method to visit nodes and build the adjacency 
+     *                     matrix, using m_path as an explicit DFS stack
      * param[in] start_x - X coordinate of the starting node
      * param[in] start_y - Y coordinate of the starting node
      *
@@ -1,6 +1,6 @@
 /*              Author: Michael Marven
  *        Date Created: 05/26/17
- *  Date Last Modified: 06/24/17
+ *  Date Last Modified: 10/17/26
  *
  */
 
@@ -290,23 +290,20 @@ void MoveValidator::printBoard(std::vector<std::vector<char> > board)
 
 /* Algorithm - Check if move is valid; Move is valid if the knight moves in an
  *             L shape - horizontal 2 spaces, then vertical 1 space, or vertical 
- *             2 spaces, then horizontal 1 space; The destination must not be 
- *             located beyond the edge of the board; The destination must not be
- *             a rock; The destination must not be a barrier and a barrier must
- *             not lie within the path of the move
+ *             2 spaces, then horizontal 1 space; The origin and destination 
+ *             must not be located beyond the edge of the board; The 
+ *             destination must not be a rock; The destination must not be a 
+ *             barrier and a barrier must not lie within the path of the move
  *
  * Note      - If the destination is a teleport node, the origin must be a
  *             teleport node; If both are teleport nodes, the move is valid
  * 
  */
-bool MoveValidator::checkMove(Vertex origin, Vertex destination)
+bool MoveValidator::checkMove(const Vertex &origin, 
+    const Vertex &destination)
 {
     // Check if move is valid
     bool is_valid_shape  = false;
-    bool dest_on_board   = false;
-    bool dest_is_rock    = false;
-    bool dest_is_barrier = false;
-    bool dest_is_blocked = false;
     bool tests_passed    = false;
 
     // Check if move is proper L shape
@@ -331,29 +328,21 @@ bool MoveValidator::checkMove(Vertex origin, Vertex destination)
         is_valid_shape = true;
     }
 
-    // Check if destination is beyond the edge of the board
-    if (isOnBoard(destination))
-    {
-        dest_on_board = true;
-    }
-
-    // Check if destination is a rock
-    if (dest_on_board && isRock(destination))
-    {
-        dest_is_rock = true;
-    }
+    // Check if origin or destination is beyond the edge of the board; An 
+    // origin off the board has no node type and no path to check
+    bool dest_on_board = isOnBoard(origin) && isOnBoard(destination);
 
-    // Check if destination is a barrier
-    if (dest_on_board && isBarrier(destination))
-    {
-        dest_is_barrier = true;
-    }
+    // Check if destination is a rock or a barrier; The node type is read once
+    // the destination is known to be on the board
+    char dest_type       = dest_on_board 
+        ? m_board[destination.y][destination.x] : '.';
+    bool dest_is_rock    = (dest_type == 'R');
+    bool dest_is_barrier = (dest_type == 'B');
 
-    // Check if destination is blocked by barrier
-    if (dest_on_board && moveIsBlocked(origin, destination))
-    {
-        dest_is_blocked = true;
-    }
+    // Check if destination is blocked by barrier; Only an L shaped move has 
+    // a path to check
+    bool dest_is_blocked = is_valid_shape && dest_on_board 
+        && moveIsBlocked(origin, destination);
 
     if (is_valid_shape && dest_on_board && !dest_is_rock && !dest_is_barrier
         && !dest_is_blocked)
@@ -373,19 +362,50 @@ bool MoveValidator::checkMove(Vertex origin, Vertex destination)
     return tests_passed;
 }
 
-/* Algorithm - Call validateMoves() to verify legality of move
+/* Algorithm - Call checkMove() to verify legality of move
+ * 
+ * Note      - The board is not marked and no move set is built, so the check
+ *             does not allocate memory
  * 
  */
-bool MoveValidator::isLegalMove(Vertex start, Vertex end)
+bool MoveValidator::isLegalMove(const Vertex &start, const Vertex &end)
 {
-    // Check legality of move
-    bool print_board = false;
-    std::vector<Vertex> move;
-    
-    move.push_back(start);
-    move.push_back(end);
-    
-    return (validateMoves(move, print_board));
+    return checkMove(start, end);
+}
+
+/* Algorithm - Build the start and end Vertex structs on the stack and call 
+ *             checkMove() to verify legality of move
+ * 
+ */
+bool MoveValidator::isLegalMove(int start_x, int start_y, int end_x, int end_y)
+{
+    Vertex start(start_x, start_y, m_board_row_size);
+    Vertex end(end_x, end_y, m_board_row_size);
+
+    return checkMove(start, end);
+}
+
+/* Algorithm - Return false for an empty move set, as validateMoves() does
+ *           - Call checkMove() for each pair of consecutive moves and return 
+ *             false at the first invalid move
+ * 
+ */
+bool MoveValidator::areLegalMoves(const std::vector<Vertex> &moves)
+{
+    if (moves.empty())
+    {
+        return false;
+    }
+
+    for (unsigned int i = 0; i + 1 < moves.size(); i++)
+    {
+        if (!checkMove(moves[i], moves[i + 1]))
+        {
+            return false;
+        }
+    }
+
+    return true;
 }
 
 /* Algorithm - Check if the move is blocked; The move is blocked if one of the
@@ -394,7 +414,7 @@ bool MoveValidator::isLegalMove(Vertex start, Vertex end)
  *             destination is a barrier
  * 
  */
-bool MoveValidator::moveIsBlocked(Vertex start, Vertex end)
+bool MoveValidator::moveIsBlocked(const Vertex &start, const Vertex &end)
 {
     bool move_is_blocked = false;
     int  horizontal_diff = 0;
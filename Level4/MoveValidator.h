@@ -3,7 +3,7 @@
 
 /*              Author: Michael Marven
  *        Date Created: 05/26/17
- *  Date Last Modified: 06/24/17
+ *  Date Last Modified: 10/17/26
  *
  */
 
@@ -33,6 +33,37 @@ public:
      */
     bool validateMoves(std::vector<Vertex> moves, bool print_moves);
 
+    /* Brief desc.     - A method to validate a set of moves without printing 
+     *                   or marking the board
+     * param[in] moves - Vector of Vertex structs representing each move
+     *
+     * param[out]      - Returns true if all moves are valid, as 
+     *                   validateMoves() does
+     *
+     */
+    bool areLegalMoves(const std::vector<Vertex> &moves);
+
+    /* Brief desc.     - A method to check if a move is legal
+     * param[in] start - Starting node
+     * param[in] end   - Ending node
+     *
+     * param[out]      - True if the move was legal
+     *
+     */
+    bool isLegalMove(const Vertex &start, const Vertex &end);
+
+    /* Brief desc.       - A method to check if a move is legal from raw 
+     *                     coordinates
+     * param[in] start_x - X coordinate of the starting node
+     * param[in] start_y - Y coordinate of the starting node
+     * param[in] end_x   - X coordinate of the ending node
+     * param[in] end_y   - Y coordinate of the ending node
+     *
+     * param[out]        - True if the move was legal
+     *
+     */
+    bool isLegalMove(int start_x, int start_y, int end_x, int end_y);
+
     /* Brief desc.     - A method to return a set of legal moves from a position
      * param[in] start - Starting node
      *
@@ -91,16 +122,7 @@ private:
      * param[out]            - Returns true if the move is valid
      *
      */
-    bool checkMove(Vertex origin, Vertex destination);
-
-    /* Brief desc.     - A method to check if a move is legal
-     * param[in] start - Starting node
-     * param[in] end   - Ending node
-     *
-     * param[out]      - True if the move was legal
-     *
-     */
-    bool isLegalMove(Vertex start, Vertex end);
+    bool checkMove(const Vertex &origin, const Vertex &destination);
 
     /* Brief desc.     - A method to check if a move is blocked by a barrier
      * param[in] start - Starting node
@@ -112,7 +134,7 @@ private:
      *                   barrier
      *
      */
-    bool moveIsBlocked(Vertex start, Vertex end);
+    bool moveIsBlocked(const Vertex &start, const Vertex &end);
 
     // Attributes
     std::vector<std::vector<char> > m_board;
@@ -0,0 +1,433 @@
+/*              Author: Michael Marven
+ *        Date Created: 10/17/26
+ *  Date Last Modified: 10/17/26
+ *
+ */
+
+#include <vector>
+#include <cstdint>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+#include "BitBoard.h"
+
+/* Algorithm - Set the bit of each node in the plane of its node type, and in
+ *             the light plane if x + y is even
+ *           - Set the bit of each node in the move plane of each direction set
+ *             in its legal move mask
+ *           - Record the teleport pair and the node number offset of each move
+ *           - Shift each move plane by the node number offset of its move into 
+ *             the landing plane of the direction
+ * 
+ */
+BitBoard::BitBoard(const BoardView &board, MoveValidator *validator)
+    : m_board_row_size(board.getRowSize()),
+    m_node_count(board.getRowCount() * board.getRowSize()),
+    m_word_count((m_node_count + 63) / 64),
+    m_teleport_one(-1),
+    m_teleport_two(-1),
+    m_planes(PLANE_COUNT, std::vector<uint64_t>(m_word_count, 0)),
+    m_move_planes(KNIGHT_MOVE_COUNT, std::vector<uint64_t>(m_word_count, 0)),
+    m_landing_planes(KNIGHT_MOVE_COUNT, 
+        std::vector<uint64_t>(m_word_count, 0)),
+    m_passable_plane(m_word_count, 0),
+    m_light_plane(m_word_count, 0)
+{
+    for (int d = 0; d < KNIGHT_MOVE_COUNT; d++)
+    {
+        m_move_offsets[d] = (KNIGHT_MOVE_Y[d] * m_board_row_size) 
+            + KNIGHT_MOVE_X[d];
+    }
+
+    for (int i = 0; i < board.getRowCount(); i++)
+    {
+        for (int j = 0; j < m_board_row_size; j++)
+        {
+            int number = (i * m_board_row_size) + j;
+
+            if ((i + j) % 2 == 0)
+            {
+                setBit(m_light_plane, number);
+            }
+
+            // Determine the plane of the node type
+            switch(board.getCell(j, i))
+            {
+                case 'R':
+                {
+                    setBit(m_planes[ROCK_PLANE], number);
+                    break;
+                }
+                case 'B':
+                {
+                    setBit(m_planes[BARRIER_PLANE], number);
+                    break;
+                }
+                case 'W':
+                {
+                    setBit(m_planes[WATER_PLANE], number);
+                    setBit(m_passable_plane, number);
+                    break;
+                }
+                case 'L':
+                {
+                    setBit(m_planes[LAVA_PLANE], number);
+                    setBit(m_passable_plane, number);
+                    break;
+                }
+                case 'T':
+                {
+                    setBit(m_planes[TELEPORT_PLANE], number);
+                    setBit(m_passable_plane, number);
+
+                    if (m_teleport_one == -1)
+                    {
+                        m_teleport_one = number;
+                    }
+                    else
+                    {
+                        m_teleport_two = number;
+                    }
+                    break;
+                }
+                default: // '.' character - normal node
+                {
+                    setBit(m_planes[FREE_PLANE], number);
+                    setBit(m_passable_plane, number);
+                }
+            }
+
+            // Set the move plane bits from the legal move mask
+            uint8_t mask = validator->getLegalMoveMask(number);
+            for (int d = 0; d < KNIGHT_MOVE_COUNT; d++)
+            {
+                if (mask & (1 << d))
+                {
+                    setBit(m_move_planes[d], number);
+                }
+            }
+        }
+    }
+
+    // A single teleport node has no pair
+    if (m_teleport_two == -1)
+    {
+        m_teleport_one = -1;
+    }
+
+    for (int d = 0; d < KNIGHT_MOVE_COUNT; d++)
+    {
+        shiftOr(m_move_planes[d], m_move_planes[d], m_move_offsets[d], 
+            m_landing_planes[d]);
+    }
+}
+
+BitBoard::~BitBoard()
+{
+    // Empty
+}
+
+/* Algorithm - Return m_word_count
+ * 
+ */
+int BitBoard::getWordCount()
+{
+    return m_word_count;
+}
+
+/* Algorithm - Return the requested plane
+ * 
+ */
+const std::vector<uint64_t> &BitBoard::getPlane(Plane plane)
+{
+    return m_planes[plane];
+}
+
+/* Algorithm - Return the move plane of the direction
+ * 
+ */
+const std::vector<uint64_t> &BitBoard::getMovePlane(int direction)
+{
+    return m_move_planes[direction];
+}
+
+/* Algorithm - Return m_passable_plane
+ * 
+ */
+const std::vector<uint64_t> &BitBoard::getPassablePlane()
+{
+    return m_passable_plane;
+}
+
+/* Algorithm - Return m_light_plane
+ * 
+ */
+const std::vector<uint64_t> &BitBoard::getLightPlane()
+{
+    return m_light_plane;
+}
+
+/* Algorithm - Clear the reachable plane
+ *           - For each direction, AND the frontier with the move plane of the
+ *             direction and shift the result by the node number offset of the
+ *             move into the reachable plane
+ *           - If exactly one teleport node was reached, move its bit to the 
+ *             other teleport node; If both were reached, they trade places and
+ *             both stay set
+ * 
+ */
+void BitBoard::expandFrontier(const std::vector<uint64_t> &frontier, 
+    std::vector<uint64_t> &reachable)
+{
+    reachable.assign(m_word_count, 0);
+
+    for (int d = 0; d < KNIGHT_MOVE_COUNT; d++)
+    {
+        shiftOr(frontier, m_move_planes[d], m_move_offsets[d], reachable);
+    }
+
+    if (m_teleport_one != -1)
+    {
+        bool reached_one = testBit(reachable, m_teleport_one);
+        bool reached_two = testBit(reachable, m_teleport_two);
+
+        if (reached_one && !reached_two)
+        {
+            clearBit(reachable, m_teleport_one);
+            setBit(reachable, m_teleport_two);
+        }
+        else if (reached_two && !reached_one)
+        {
+            clearBit(reachable, m_teleport_two);
+            setBit(reachable, m_teleport_one);
+        }
+    }
+}
+
+/* Algorithm - Clear the sources plane
+ *           - For each direction, AND the frontier with the landing plane of 
+ *             the direction and shift the result back by the node number offset
+ *             of the move into the sources plane
+ * 
+ */
+void BitBoard::expandFrontierReverse(const std::vector<uint64_t> &frontier, 
+    std::vector<uint64_t> &sources)
+{
+    sources.assign(m_word_count, 0);
+
+    for (int d = 0; d < KNIGHT_MOVE_COUNT; d++)
+    {
+        shiftOr(frontier, m_landing_planes[d], -m_move_offsets[d], sources);
+    }
+}
+
+/* Algorithm - For each word, AND the reachable word with the passable word and 
+ *             the complement of the visited word
+ *           - OR the result into the visited word and note if it is nonzero
+ * 
+ */
+bool BitBoard::mergeFrontier(std::vector<uint64_t> &reachable, 
+    const std::vector<uint64_t> &passable, std::vector<uint64_t> &visited)
+{
+    int      word_count = reachable.size();
+    int      i          = 0;
+    uint64_t found      = 0;
+
+#ifdef __AVX2__
+    __m256i found_vec = _mm256_setzero_si256();
+    for (; i + 4 <= word_count; i += 4)
+    {
+        __m256i reach = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i *>(&reachable[i]));
+        __m256i pass  = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i *>(&passable[i]));
+        __m256i seen  = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i *>(&visited[i]));
+
+        // New nodes are reachable, passable and not visited
+        reach = _mm256_andnot_si256(seen, _mm256_and_si256(reach, pass));
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(&reachable[i]), reach);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(&visited[i]), 
+            _mm256_or_si256(seen, reach));
+        found_vec = _mm256_or_si256(found_vec, reach);
+    }
+    found = !_mm256_testz_si256(found_vec, found_vec);
+#endif
+
+    for (; i < word_count; i++)
+    {
+        reachable[i] &= passable[i] & ~visited[i];
+        visited[i]   |= reachable[i];
+        found        |= reachable[i];
+    }
+
+    return found != 0;
+}
+
+/* Algorithm - Split the shift into whole words and remaining bits
+ *           - Each target word combines the (source AND mask) word the shift 
+ *             moves into it (the near word) with the neighboring word the 
+ *             remaining bits carry over from (the far word)
+ *           - For the interior target words both words are inside the plane, 
+ *             so they are done without bounds checks, four at a time with AVX2
+ *           - The remaining target words at each end check the bounds and 
+ *             count words outside the plane as zero
+ * 
+ * Note      - The far word is shifted in two steps, so a bit shift of 0 leaves
+ *             nothing of it without an undefined shift by 64
+ * 
+ */
+void BitBoard::shiftOr(const std::vector<uint64_t> &source, 
+    const std::vector<uint64_t> &mask, int shift, 
+    std::vector<uint64_t> &target)
+{
+    int  word_count = target.size();
+    bool upward     = (shift >= 0);
+    int  distance   = upward ? shift : -shift;
+    int  word_shift = distance / 64;
+    int  bit_shift  = distance % 64;
+
+    // Offset of the near word from the target word and of the far word from 
+    // the near word
+    int near_offset = upward ? -word_shift : word_shift;
+    int far_offset  = upward ? -1 : 1;
+
+    // Range of interior target words
+    int interior_first = upward ? word_shift + 1 : 0;
+    int interior_last  = upward ? word_count : word_count - word_shift - 1;
+    if (interior_first > word_count)
+    {
+        interior_first = word_count;
+    }
+    if (interior_last < interior_first)
+    {
+        interior_last = interior_first;
+    }
+
+    int i = interior_first;
+
+#ifdef __AVX2__
+    __m128i near_count = _mm_cvtsi32_si128(bit_shift);
+    __m128i far_count  = _mm_cvtsi32_si128(63 - bit_shift);
+    __m128i one_count  = _mm_cvtsi32_si128(1);
+
+    for (; i + 4 <= interior_last; i += 4)
+    {
+        int near_word = i + near_offset;
+        int far_word  = near_word + far_offset;
+
+        __m256i near_bits = _mm256_and_si256(
+            _mm256_loadu_si256(
+                reinterpret_cast<const __m256i *>(&source[near_word])),
+            _mm256_loadu_si256(
+                reinterpret_cast<const __m256i *>(&mask[near_word])));
+        __m256i far_bits  = _mm256_and_si256(
+            _mm256_loadu_si256(
+                reinterpret_cast<const __m256i *>(&source[far_word])),
+            _mm256_loadu_si256(
+                reinterpret_cast<const __m256i *>(&mask[far_word])));
+
+        __m256i word;
+        if (upward)
+        {
+            word = _mm256_or_si256(_mm256_sll_epi64(near_bits, near_count),
+                _mm256_srl_epi64(_mm256_srl_epi64(far_bits, one_count), 
+                far_count));
+        }
+        else
+        {
+            word = _mm256_or_si256(_mm256_srl_epi64(near_bits, near_count),
+                _mm256_sll_epi64(_mm256_sll_epi64(far_bits, one_count), 
+                far_count));
+        }
+
+        __m256i *out = reinterpret_cast<__m256i *>(&target[i]);
+        _mm256_storeu_si256(out, _mm256_or_si256(_mm256_loadu_si256(out), word));
+    }
+#endif
+
+    // Interior target words
+    for (; i < interior_last; i++)
+    {
+        int      near_word = i + near_offset;
+        int      far_word  = near_word + far_offset;
+        uint64_t near_bits = source[near_word] & mask[near_word];
+        uint64_t far_bits  = source[far_word] & mask[far_word];
+
+        if (upward)
+        {
+            target[i] |= (near_bits << bit_shift) 
+                | ((far_bits >> 1) >> (63 - bit_shift));
+        }
+        else
+        {
+            target[i] |= (near_bits >> bit_shift) 
+                | ((far_bits << 1) << (63 - bit_shift));
+        }
+    }
+
+    // Target words at each end of the plane
+    for (int i = 0; i < word_count; i++)
+    {
+        if (i == interior_first)
+        {
+            i = interior_last;
+            if (i == word_count)
+            {
+                continue;
+            }
+        }
+
+        int      near_word = i + near_offset;
+        int      far_word  = near_word + far_offset;
+        uint64_t near_bits = 0;
+        uint64_t far_bits  = 0;
+
+        if (near_word >= 0 && near_word < word_count)
+        {
+            near_bits = source[near_word] & mask[near_word];
+        }
+        if (far_word >= 0 && far_word < word_count)
+        {
+            far_bits = source[far_word] & mask[far_word];
+        }
+
+        if (upward)
+        {
+            target[i] |= (near_bits << bit_shift) 
+                | ((far_bits >> 1) >> (63 - bit_shift));
+        }
+        else
+        {
+            target[i] |= (near_bits >> bit_shift) 
+                | ((far_bits << 1) << (63 - bit_shift));
+        }
+    }
+}
+
+/* Algorithm - Check bit number % 64 of word number / 64
+ * 
+ */
+bool BitBoard::testBit(const std::vector<uint64_t> &plane, int number)
+{
+    return ((plane[number >> 6] >> (number & 63)) & 1) != 0;
+}
+
+/* Algorithm - Set bit number % 64 of word number / 64
+ * 
+ */
+void BitBoard::setBit(std::vector<uint64_t> &plane, int number)
+{
+    plane[number >> 6] |= (static_cast<uint64_t>(1) << (number & 63));
+}
+
+/* Algorithm - Clear bit number % 64 of word number / 64
+ * 
+ */
+void BitBoard::clearBit(std::vector<uint64_t> &plane, int number)
+{
+    plane[number >> 6] &= ~(static_cast<uint64_t>(1) << (number & 63));
+}
@@ -0,0 +1,195 @@
+#ifndef BIT_BOARD_H
+#define BIT_BOARD_H
+
+/*              Author: Michael Marven
+ *        Date Created: 10/17/26
+ *  Date Last Modified: 10/17/26
+ *
+ */
+
+#include <vector>
+#include <cstdint>
+
+#include "CommonDefs.h"
+#include "MoveValidator.h"
+#include "BoardView.h"
+
+/* Brief desc. - A bitboard representation of a Knight Board
+ * Details     - Each plane holds one bit per node, indexed by node number, in
+ *               64 bit words; Bit n of word n / 64 is bit n % 64
+ *             - Move plane i has the bit of a node set if the knight move in 
+ *               direction i (see KNIGHT_MOVE_X and KNIGHT_MOVE_Y) is legal from
+ *               that node, so it already accounts for the board edges, rocks, 
+ *               barriers and barriers in the path of the move
+ *             - The word loops use AVX2 when the compiler targets it (see
+ *               SIMD in the Makefile) and plain 64 bit words otherwise
+ *
+ */
+class BitBoard
+{
+public:
+
+    // Cell planes
+    enum Plane
+    {
+        FREE_PLANE,
+        ROCK_PLANE,
+        BARRIER_PLANE,
+        WATER_PLANE,
+        LAVA_PLANE,
+        TELEPORT_PLANE,
+        PLANE_COUNT
+    };
+
+    // Constructor
+    BitBoard(const BoardView &board, MoveValidator *validator);
+
+    // Destructor
+    ~BitBoard();
+
+    /* Brief desc. - A method to retrieve the number of 64 bit words in a plane
+     * param[out]  - Returns the number of words
+     *
+     */
+    int getWordCount();
+
+    /* Brief desc.     - A method to retrieve a cell plane
+     * param[in] plane - Plane to retrieve
+     *
+     * param[out]      - Returns a reference to the plane
+     *
+     */
+    const std::vector<uint64_t> &getPlane(Plane plane);
+
+    /* Brief desc.         - A method to retrieve the plane of nodes that have
+     *                       a legal move in a direction
+     * param[in] direction - Direction of the move
+     *
+     * param[out]          - Returns a reference to the move plane
+     *
+     */
+    const std::vector<uint64_t> &getMovePlane(int direction);
+
+    /* Brief desc. - A method to retrieve the plane of nodes a knight may stand
+     *               on: free, water, lava and teleport nodes
+     * param[out]  - Returns a reference to the passable plane
+     *
+     */
+    const std::vector<uint64_t> &getPassablePlane();
+
+    /* Brief desc. - A method to retrieve the plane of light nodes, the nodes 
+     *               whose x + y is even; A knight move always changes the 
+     *               color of the node
+     * param[out]  - Returns a reference to the light plane
+     *
+     */
+    const std::vector<uint64_t> &getLightPlane();
+
+    /* Brief desc.          - A method to generate every node reachable with one 
+     *                        legal move from a set of nodes
+     * param[in] frontier   - Plane of the nodes to move from
+     * param[out] reachable - Plane to receive the reachable nodes; It must have
+     *                        getWordCount() words
+     *
+     * Note                 - A move to a teleport node reaches the other 
+     *                        teleport node instead, as in the KnightGraph 
+     *                        adjacency list
+     *
+     */
+    void expandFrontier(const std::vector<uint64_t> &frontier, 
+        std::vector<uint64_t> &reachable);
+
+    /* Brief desc.        - A method to generate every node with a legal move 
+     *                      onto a set of nodes
+     * param[in] frontier - Plane of the nodes to move onto
+     * param[out] sources - Plane to receive the nodes with a legal move onto
+     *                      the frontier; It must have getWordCount() words
+     *
+     * Note               - Teleport nodes are not followed, so a move onto a 
+     *                      teleport node ends on it
+     *
+     */
+    void expandFrontierReverse(const std::vector<uint64_t> &frontier, 
+        std::vector<uint64_t> &sources);
+
+    /* Brief desc.          - A method to keep only the new passable nodes of a
+     *                        reachable plane and add them to a visited plane
+     * param[in] reachable  - Plane of reachable nodes; On return it holds only
+     *                        the passable nodes that were not visited
+     * param[in] passable   - Plane of the nodes a knight may stand on
+     * param[out] visited   - Plane of the visited nodes; The new nodes are 
+     *                        added to it
+     *
+     * param[out]           - Returns true if any new node was found
+     *
+     */
+    static bool mergeFrontier(std::vector<uint64_t> &reachable, 
+        const std::vector<uint64_t> &passable, std::vector<uint64_t> &visited);
+
+    /* Brief desc.        - A method to OR a masked plane shifted by a number of
+     *                      bits into another plane
+     * param[in] source   - Plane to shift
+     * param[in] mask     - Plane to AND with source before shifting
+     * param[in] shift    - Number of bits to shift towards higher node numbers;
+     *                      A negative shift moves towards lower node numbers
+     * param[out] target  - Plane to OR the result into
+     *
+     */
+    static void shiftOr(const std::vector<uint64_t> &source, 
+        const std::vector<uint64_t> &mask, int shift, 
+        std::vector<uint64_t> &target);
+
+    /* Brief desc.      - A method to check a node bit in a plane
+     * param[in] plane  - Plane to check
+     * param[in] number - Number of the node
+     *
+     * param[out]       - Returns true if the bit is set
+     *
+     */
+    static bool testBit(const std::vector<uint64_t> &plane, int number);
+
+    /* Brief desc.      - A method to set a node bit in a plane
+     * param[in] plane  - Plane to change
+     * param[in] number - Number of the node
+     *
+     */
+    static void setBit(std::vector<uint64_t> &plane, int number);
+
+    /* Brief desc.      - A method to clear a node bit in a plane
+     * param[in] plane  - Plane to change
+     * param[in] number - Number of the node
+     *
+     */
+    static void clearBit(std::vector<uint64_t> &plane, int number);
+
+private:
+
+    // Attributes
+    int m_board_row_size;
+
+    int m_node_count;
+
+    int m_word_count;
+
+    // Numbers of the teleport nodes, or -1 if the board has no teleport pair
+    int m_teleport_one;
+
+    int m_teleport_two;
+
+    // Node number offset of a move in each direction
+    int m_move_offsets[KNIGHT_MOVE_COUNT];
+
+    std::vector<std::vector<uint64_t> > m_planes;
+
+    std::vector<std::vector<uint64_t> > m_move_planes;
+
+    // Landing plane i has the bit of a node set if a legal move in direction i
+    // lands on that node
+    std::vector<std::vector<uint64_t> > m_landing_planes;
+
+    std::vector<uint64_t> m_passable_plane;
+
+    std::vector<uint64_t> m_light_plane;
+};
+
+#endif // BIT_BOARD_H
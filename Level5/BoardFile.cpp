@@ -0,0 +1,404 @@
+/*              Author: Michael Marven
+ *        Date Created: 10/17/26
+ *  Date Last Modified: 10/17/26
+ *
+ */
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "BoardFile.h"
+
+BoardFile::BoardFile()
+    : m_data(NULL),
+    m_size(0)
+{
+    // Empty
+}
+
+BoardFile::~BoardFile()
+{
+    unload();
+}
+
+/* Algorithm - Unmap a board loaded earlier
+ *           - Open the file, find its size and map it read only; The file
+ *             descriptor is closed once the file is mapped
+ *           - Check the mapped board with checkBinaryBoard() if the file starts
+ *             with the binary magic, otherwise with checkTextBoard(); Unmap 
+ *             the file if the board is invalid
+ *
+ */
+bool BoardFile::load(const char *file_name)
+{
+    unload();
+
+    int fd = open(file_name, O_RDONLY);
+    if (fd == -1)
+    {
+        std::cout << "Board file " << file_name << " could not be opened.\n";
+        return false;
+    }
+
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) == -1 || file_stat.st_size == 0)
+    {
+        std::cout << "Board file " << file_name << " is empty.\n";
+        close(fd);
+        return false;
+    }
+
+    void *data = mmap(NULL, file_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+
+    if (data == MAP_FAILED)
+    {
+        std::cout << "Board file " << file_name << " could not be mapped.\n";
+        return false;
+    }
+
+    m_data = static_cast<const char *>(data);
+    m_size = file_stat.st_size;
+
+    // The rows are read once, front to back
+    madvise(data, m_size, MADV_SEQUENTIAL);
+
+    bool is_binary = (m_size >= sizeof(BoardFileHeader) 
+        && memcmp(m_data, "KBRD", 4) == 0);
+
+    if (!(is_binary ? checkBinaryBoard() : checkTextBoard()))
+    {
+        std::cout << "Board file " << file_name << " is not a valid board.\n";
+        unload();
+        return false;
+    }
+
+    return true;
+}
+
+/* Algorithm - Return m_board
+ *
+ */
+BoardView BoardFile::getBoard() const
+{
+    return m_board;
+}
+
+/* Algorithm - The row size is the length of the first line and the line ending
+ *             is "\r\n" if the first line ends with '\r', otherwise "\n"
+ *           - Loop through the rows once:
+ *               - Every char of the row must be one of '.', 'W', 'L', 'R',
+ *                 'B', 'T'; The chars are checked without branching so the 
+ *                 loop is vectorized
+ *               - The row must be followed by a line ending that matches the
+ *                 first one; The line ending of the last row may be left out
+ *           - The node count must be at most MAX_BOARD_NODES
+ *           - Set m_board to view the rows in place, with a row stride of the
+ *             row size plus the line ending length
+ *
+ */
+bool BoardFile::checkTextBoard()
+{
+    // Find the row size and line ending from the first line
+    size_t row_size = 0;
+    while (row_size < m_size && m_data[row_size] != '\n')
+    {
+        row_size++;
+    }
+
+    size_t ending_size = 1;
+    if (row_size > 0 && m_data[row_size - 1] == '\r')
+    {
+        row_size--;
+        ending_size = 2;
+    }
+
+    if (row_size == 0)
+    {
+        return false;
+    }
+
+    size_t row_count = 0;
+    size_t i         = 0;
+
+    while (i < m_size)
+    {
+        // Row must be full
+        if (m_size - i < row_size)
+        {
+            return false;
+        }
+
+        // Count the chars that are not node types
+        const char *row     = m_data + i;
+        int         invalid = 0;
+        for (size_t j = 0; j < row_size; j++)
+        {
+            char node_type = row[j];
+            invalid += (node_type != '.') & (node_type != 'W') 
+                & (node_type != 'L') & (node_type != 'R') 
+                & (node_type != 'B') & (node_type != 'T');
+        }
+
+        if (invalid != 0)
+        {
+            return false;
+        }
+
+        row_count++;
+        i += row_size;
+
+        // Line ending must match the first one, unless it ends the file
+        if (i < m_size)
+        {
+            if (m_size - i < ending_size 
+                || (ending_size == 2 && m_data[i] != '\r')
+                || m_data[i + ending_size - 1] != '\n')
+            {
+                return false;
+            }
+            i += ending_size;
+        }
+    }
+
+    // Node numbers must fit in an int
+    if (row_count > static_cast<size_t>(MAX_BOARD_NODES) / row_size)
+    {
+        return false;
+    }
+
+    m_board = BoardView(m_data, row_size, row_count, row_size + ending_size);
+
+    return true;
+}
+
+/* Algorithm - Check the version and dimensions in the header; The node count
+ *             must be at most MAX_BOARD_NODES
+ *           - The file size must match the padded teleport list and packed 
+ *             board sizes
+ *           - Fold the teleport list into the checksum, then fold the packed 
+ *             board 768 words at a time; The words hold the codes of 16384 
+ *             nodes, which are checked with checkPackedCodes() while the words
+ *             are in the cache
+ *           - The checksum must match the header, every code must be a node 
+ *             type, and the board must have as many teleport nodes as the 
+ *             teleport list and no more than two
+ *           - Set m_board to view the packed board in place
+ *           - The teleport list must hold distinct teleport nodes
+ *
+ */
+bool BoardFile::checkBinaryBoard()
+{
+    const BoardFileHeader *header = 
+        reinterpret_cast<const BoardFileHeader *>(m_data);
+
+    if (header->version != BOARD_FILE_VERSION || header->row_size == 0 
+        || header->row_count == 0)
+    {
+        return false;
+    }
+
+    uint64_t node_count = static_cast<uint64_t>(header->row_size) 
+        * header->row_count;
+    if (node_count > static_cast<uint64_t>(MAX_BOARD_NODES))
+    {
+        return false;
+    }
+
+    uint64_t teleport_size = ((header->teleport_count * 4ULL) + 7) / 8 * 8;
+    uint64_t packed_size   = ((((node_count * 3) + 7) / 8) + 1 + 7) / 8 * 8;
+    if (m_size != sizeof(BoardFileHeader) + teleport_size + packed_size)
+    {
+        return false;
+    }
+
+    const char          *body   = m_data + sizeof(BoardFileHeader);
+    const uint64_t      *words  = reinterpret_cast<const uint64_t *>(body);
+    const unsigned char *packed = 
+        reinterpret_cast<const unsigned char *>(body + teleport_size);
+
+    // Check the checksum and the node codes in one pass, 768 words at a time
+    uint64_t checksum       = foldChecksum(CHECKSUM_BASIS, words, 
+        teleport_size / 8);
+    uint64_t packed_words   = packed_size / 8;
+    int      node_end       = node_count;
+    int      teleport_nodes = 0;
+
+    words += teleport_size / 8;
+    for (uint64_t w = 0; w < packed_words; w += 768)
+    {
+        checksum = foldChecksum(checksum, words + w, 
+            std::min<uint64_t>(768, packed_words - w));
+
+        int first = (w / 3) * 64;
+        if (first < node_end)
+        {
+            int teleports = BoardView::checkPackedCodes(packed, first, 
+                std::min(first + 16384, node_end));
+            if (teleports == -1)
+            {
+                return false;
+            }
+            teleport_nodes += teleports;
+        }
+    }
+
+    if (checksum != header->checksum 
+        || static_cast<uint32_t>(teleport_nodes) != header->teleport_count
+        || teleport_nodes > 2)
+    {
+        return false;
+    }
+
+    // Check the teleport list against the board
+    const uint32_t *teleports = reinterpret_cast<const uint32_t *>(body);
+    m_board = BoardView::fromPacked(packed, header->row_size, 
+        header->row_count);
+
+    for (uint32_t i = 0; i < header->teleport_count; i++)
+    {
+        if (teleports[i] >= node_count 
+            || m_board.getCell(teleports[i] % header->row_size, 
+                teleports[i] / header->row_size) != 'T'
+            || (i > 0 && teleports[i] == teleports[0]))
+        {
+            m_board = BoardView();
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/* Algorithm - Fold the words into CHECKSUM_BASIS
+ *
+ */
+uint64_t BoardFile::calcChecksum(const uint64_t *words, size_t count)
+{
+    return foldChecksum(CHECKSUM_BASIS, words, count);
+}
+
+/* Algorithm - Loop through the words and fold each into the checksum with the
+ *             FNV-1a steps, a word at a time
+ *
+ */
+uint64_t BoardFile::foldChecksum(uint64_t checksum, const uint64_t *words, 
+    size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        checksum ^= words[i];
+        checksum *= 1099511628211ULL;
+    }
+
+    return checksum;
+}
+
+/* Algorithm - Write each row of node type chars followed by "\n"
+ *
+ */
+bool BoardFile::writeTextBoard(const BoardView &board, const char *file_name)
+{
+    std::ofstream file(file_name, std::ios::binary);
+    if (!file)
+    {
+        std::cout << "Board file " << file_name << " could not be opened.\n";
+        return false;
+    }
+
+    std::vector<char> row(board.getRowSize() + 1, '\n');
+    for (int i = 0; i < board.getRowCount(); i++)
+    {
+        for (int j = 0; j < board.getRowSize(); j++)
+        {
+            row[j] = board.getCell(j, i);
+        }
+
+        file.write(&row[0], row.size());
+    }
+
+    return static_cast<bool>(file);
+}
+
+/* Algorithm - Record the node number of each teleport node
+ *           - Copy the teleport list and the packed board into a body of 
+ *             words, each padded with zeros to a multiple of 8 bytes
+ *           - Fill in the header with the checksum of the body, then write the
+ *             header and the body
+ *
+ */
+bool BoardFile::writeBinaryBoard(const BoardView &board, 
+    const char *file_name)
+{
+    std::vector<uint32_t> teleports;
+    for (int i = 0; i < board.getRowCount(); i++)
+    {
+        for (int j = 0; j < board.getRowSize(); j++)
+        {
+            if (board.getCell(j, i) == 'T')
+            {
+                teleports.push_back((i * board.getRowSize()) + j);
+            }
+        }
+    }
+
+    std::vector<unsigned char> packed;
+    board.pack(packed);
+
+    size_t teleport_size = ((teleports.size() * 4) + 7) / 8 * 8;
+    size_t packed_size   = (packed.size() + 7) / 8 * 8;
+
+    std::vector<uint64_t> body((teleport_size + packed_size) / 8, 0);
+    char *body_bytes = reinterpret_cast<char *>(&body[0]);
+    if (!teleports.empty())
+    {
+        memcpy(body_bytes, &teleports[0], teleports.size() * 4);
+    }
+    memcpy(body_bytes + teleport_size, &packed[0], packed.size());
+
+    BoardFileHeader header;
+    memcpy(header.magic, "KBRD", 4);
+    header.version        = BOARD_FILE_VERSION;
+    header.row_size       = board.getRowSize();
+    header.row_count      = board.getRowCount();
+    header.teleport_count = teleports.size();
+    header.reserved       = 0;
+    header.checksum       = calcChecksum(&body[0], body.size());
+
+    std::ofstream file(file_name, std::ios::binary);
+    if (!file)
+    {
+        std::cout << "Board file " << file_name << " could not be opened.\n";
+        return false;
+    }
+
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    file.write(body_bytes, body.size() * 8);
+
+    return static_cast<bool>(file);
+}
+
+/* Algorithm - Unmap the file if one is mapped and clear m_board
+ *
+ */
+void BoardFile::unload()
+{
+    if (m_data)
+    {
+        munmap(const_cast<char *>(m_data), m_size);
+    }
+
+    m_data  = NULL;
+    m_size  = 0;
+    m_board = BoardView();
+}
@@ -0,0 +1,172 @@
+#ifndef BOARD_FILE_H
+#define BOARD_FILE_H
+
+/*              Author: Michael Marven
+ *        Date Created: 10/17/26
+ *  Date Last Modified: 10/17/26
+ *
+ */
+
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+
+#include "BoardView.h"
+
+// Version of the binary board file format
+const uint32_t BOARD_FILE_VERSION = 1;
+
+// Largest number of nodes of a text or binary board; The node numbers and the
+// bit index of the code of every node must fit in an int
+const int MAX_BOARD_NODES = INT_MAX / 3;
+
+// Starting value of a board or graph file checksum
+const uint64_t CHECKSUM_BASIS = 14695981039346656037ULL;
+
+/* Brief desc.              - A struct for the header of a binary board file
+ * param     magic          - "KBRD"
+ * param     version        - BOARD_FILE_VERSION
+ * param     row_size       - Number of nodes in a row
+ * param     row_count      - Number of rows
+ * param     teleport_count - Number of teleport nodes in the teleport list
+ * param     reserved       - Zero
+ * param     checksum       - Checksum of the bytes after the header
+ *
+ * Details                  - The header is followed by the teleport list, one
+ *                            uint32_t node number per teleport node, then the
+ *                            packed board (see BoardView); Both are padded with
+ *                            zeros to a multiple of 8 bytes
+ *                          - The teleport list holds every teleport node of the
+ *                            board, and a board has at most two
+ *                          - Numbers are stored in the byte order of the host
+ *
+ */
+struct BoardFileHeader
+{
+    char     magic[4];
+    uint32_t version;
+    uint32_t row_size;
+    uint32_t row_count;
+    uint32_t teleport_count;
+    uint32_t reserved;
+    uint64_t checksum;
+};
+
+/* Brief desc. - A Knight Board file mapped into memory
+ * Details     - A text file holds one row of node type chars ('.', 'W', 'L', 
+ *               'R', 'B', 'T') per line; Lines end with "\n" or "\r\n", the 
+ *               same for every line, and the last line ending may be left out
+ *             - A binary file holds a 3 bit code per node (see 
+ *               BoardFileHeader); It is about a third of the size of a text 
+ *               file
+ *             - The board is viewed in place in the mapped bytes, so
+ *               KnightGraph and MoveValidator objects can be constructed over
+ *               getBoard() without copying it; The BoardFile object must
+ *               outlive them
+ *
+ */
+class BoardFile
+{
+public:
+
+    // Constructor
+    BoardFile();
+
+    // Destructor
+    ~BoardFile();
+
+    /* Brief desc.         - A method to map a text or binary board file and
+     *                       check it
+     * param[in] file_name - Name of the board file
+     *
+     * param[out]          - Returns true if the file was mapped and holds a
+     *                       valid board; Otherwise prints the reason and
+     *                       returns false
+     *
+     * Note                - A board loaded earlier is unmapped first
+     *
+     */
+    bool load(const char *file_name);
+
+    /* Brief desc. - A method to retrieve the view of the loaded board
+     * param[out]  - Returns the view; The view is empty if no board is loaded
+     *
+     */
+    BoardView getBoard() const;
+
+    /* Brief desc.         - A method to write a board to a text board file
+     * param[in] board     - View of the board
+     * param[in] file_name - Name of the board file
+     *
+     * param[out]          - Returns true if the file was written
+     *
+     */
+    static bool writeTextBoard(const BoardView &board, const char *file_name);
+
+    /* Brief desc.         - A method to write a board to a binary board file
+     * param[in] board     - View of the board
+     * param[in] file_name - Name of the board file
+     *
+     * param[out]          - Returns true if the file was written
+     *
+     */
+    static bool writeBinaryBoard(const BoardView &board, 
+        const char *file_name);
+
+    /* Brief desc.     - A method to compute the checksum of the words after
+     *                   the header of a binary board or graph file
+     * param[in] words - Words following the header
+     * param[in] count - Number of words
+     *
+     * param[out]      - Returns the checksum
+     *
+     */
+    static uint64_t calcChecksum(const uint64_t *words, size_t count);
+
+    /* Brief desc.        - A method to fold more words into a checksum, so
+     *                      the words can be checked a block at a time
+     * param[in] checksum - Checksum of the words before, or CHECKSUM_BASIS
+     * param[in] words    - Words to fold in
+     * param[in] count    - Number of words
+     *
+     * param[out]         - Returns the checksum
+     *
+     */
+    static uint64_t foldChecksum(uint64_t checksum, const uint64_t *words, 
+        size_t count);
+
+private:
+
+    // Not copyable, as the mapping is unmapped by the destructor
+    BoardFile(const BoardFile &other);
+    BoardFile &operator=(const BoardFile &other);
+
+    /* Brief desc. - A method to check the rows of mapped text in a single pass
+     *               and set m_board
+     * param[out]  - Returns true if the rows are a valid board
+     *
+     */
+    bool checkTextBoard();
+
+    /* Brief desc. - A method to check the header, checksum, node codes and 
+     *               teleport list of a mapped binary board and set m_board
+     * param[out]  - Returns true if the file is a valid board
+     *
+     */
+    bool checkBinaryBoard();
+
+    /* Brief desc. - A method to unmap the file and clear m_board
+     *
+     */
+    void unload();
+
+    // Attributes
+    const char *m_data;
+
+    size_t m_size;
+
+    BoardView m_board;
+
+};
+
+#endif // BOARD_FILE_H
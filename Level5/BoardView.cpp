@@ -0,0 +1,261 @@
+/*              Author: Michael Marven
+ *        Date Created: 10/17/26
+ *  Date Last Modified: 10/17/26
+ *
+ */
+
+#include <vector>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "BoardView.h"
+
+BoardView::BoardView()
+    : m_cells(NULL),
+    m_packed_cells(NULL),
+    m_row_size(0),
+    m_row_count(0),
+    m_row_stride(0)
+{
+    // Empty
+}
+
+BoardView::BoardView(const char *cells, int row_size, int row_count,
+    int row_stride)
+    : m_cells(cells),
+    m_packed_cells(NULL),
+    m_row_size(row_size),
+    m_row_count(row_count),
+    m_row_stride(row_stride)
+{
+    // Empty
+}
+
+BoardView::~BoardView()
+{
+    // Empty
+}
+
+/* Algorithm - Size cells for every node of the board, then copy each row into
+ *             place
+ *           - Return a view of cells with a row stride equal to the row size
+ *
+ */
+BoardView BoardView::fromRows(const std::vector<std::vector<char> > &board,
+    std::vector<char> &cells)
+{
+    int row_count = board.size();
+    int row_size  = board[0].size();
+
+    cells.resize(row_count * row_size);
+
+    for (int i = 0; i < row_count; i++)
+    {
+        std::copy(board[i].begin(), board[i].begin() + row_size,
+            cells.begin() + (i * row_size));
+    }
+
+    return BoardView(&cells[0], row_size, row_count, row_size);
+}
+
+/* Algorithm - Return a view with no char buffer and m_packed_cells set to the
+ *             packed buffer
+ *
+ */
+BoardView BoardView::fromPacked(const unsigned char *packed_cells, 
+    int row_size, int row_count)
+{
+    BoardView board(NULL, row_size, row_count, row_size);
+    board.m_packed_cells = packed_cells;
+
+    return board;
+}
+
+// The words of a block of packed nodes are read in the byte order of the 
+// host, which lines the codes up only on a little endian host
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__)
+#error "BoardView::checkPackedCodes() requires a little endian host"
+#endif
+
+// First bit of each code in the 3 words of a block of 64 packed nodes
+static const uint64_t FIRST_CODE_BITS[3] = { 0x9249249249249249ULL, 
+    0x4924924924924924ULL, 0x2492492492492492ULL };
+
+/* Algorithm - Read the code of the node from the two bytes holding bit 3n
+ *
+ */
+static int readPackedCode(const unsigned char *packed_cells, int number)
+{
+    int bit = number * 3;
+    const unsigned char *code_bytes = packed_cells + (bit >> 3);
+
+    return ((code_bytes[0] | (code_bytes[1] << 8)) >> (bit & 7)) & 7;
+}
+
+/* Algorithm - Check the nodes before the first whole block of 64 nodes and 
+ *             after the last one a code at a time
+ *           - A block of 64 nodes fills 3 words; Shift the words right by 1 and
+ *             2 bits so the second and third bits of each code line up with its
+ *             first bit, then mask the first bit of each code:
+ *             - A code of 6 or 7 has its second and third bits set
+ *             - A teleport code of 5 has its first and third bits set and its
+ *               second bit clear
+ *
+ */
+int BoardView::checkPackedCodes(const unsigned char *packed_cells, int first,
+    int end)
+{
+    int invalid   = 0;
+    int teleports = 0;
+    int n         = first;
+
+    // Nodes before the first whole block
+    int block_start = std::min(end, ((first + 63) / 64) * 64);
+    for (; n < block_start; n++)
+    {
+        int code = readPackedCode(packed_cells, n);
+        invalid   += (code >= NODE_TYPE_COUNT);
+        teleports += (NODE_TYPES[code] == 'T');
+    }
+
+    // Whole blocks of 64 nodes; The codes of 6 or 7 are gathered and the rare
+    // teleport codes are counted as they are found
+    const unsigned char *block        = packed_cells + ((n / 64) * 24);
+    uint64_t             invalid_bits = 0;
+    for (; n + 64 <= end; n += 64, block += 24)
+    {
+        uint64_t words[3];
+        memcpy(&words[0], block, 8);
+        memcpy(&words[1], block + 8, 8);
+        memcpy(&words[2], block + 16, 8);
+
+        uint64_t seconds[3] = { (words[0] >> 1) | (words[1] << 63), 
+            (words[1] >> 1) | (words[2] << 63), words[2] >> 1 };
+        uint64_t thirds[3]  = { (words[0] >> 2) | (words[1] << 62), 
+            (words[1] >> 2) | (words[2] << 62), words[2] >> 2 };
+
+        uint64_t teleport_bits = 0;
+        for (int w = 0; w < 3; w++)
+        {
+            invalid_bits  |= seconds[w] & thirds[w] & FIRST_CODE_BITS[w];
+            teleport_bits |= words[w] & ~seconds[w] & thirds[w] 
+                & FIRST_CODE_BITS[w];
+        }
+
+        // Count the teleport codes of the block
+        if (teleport_bits != 0)
+        {
+            for (int w = 0; w < 3; w++)
+            {
+                teleports += __builtin_popcountll(words[w] & ~seconds[w] 
+                    & thirds[w] & FIRST_CODE_BITS[w]);
+            }
+        }
+    }
+    invalid += (invalid_bits != 0);
+
+    // Nodes after the last whole block
+    for (; n < end; n++)
+    {
+        int code = readPackedCode(packed_cells, n);
+        invalid   += (code >= NODE_TYPE_COUNT);
+        teleports += (NODE_TYPES[code] == 'T');
+    }
+
+    return (invalid == 0) ? teleports : -1;
+}
+
+/* Algorithm - Size packed for 3 bits per node plus one byte, cleared
+ *           - Loop through each node and find the code of its node type in
+ *             NODE_TYPES; Or the code into the two bytes holding bit 3n
+ *
+ */
+void BoardView::pack(std::vector<unsigned char> &packed) const
+{
+    int node_count = m_row_size * m_row_count;
+
+    packed.assign(((static_cast<long long>(node_count) * 3) + 7) / 8 + 1, 0);
+
+    for (int i = 0; i < m_row_count; i++)
+    {
+        for (int j = 0; j < m_row_size; j++)
+        {
+            char node_type = getCell(j, i);
+
+            // Unknown node types are packed as rocks
+            int code = 3;
+            for (int c = 0; c < NODE_TYPE_COUNT; c++)
+            {
+                if (NODE_TYPES[c] == node_type)
+                {
+                    code = c;
+                }
+            }
+
+            int bit   = ((i * m_row_size) + j) * 3;
+            int value = code << (bit & 7);
+
+            packed[bit >> 3]       |= value & 0xFF;
+            packed[(bit >> 3) + 1] |= value >> 8;
+        }
+    }
+}
+
+/* Algorithm - Size cells for every node of the board, then copy each node type
+ *             char into place with getCell()
+ *
+ */
+void BoardView::copyCells(std::vector<char> &cells) const
+{
+    cells.resize(m_row_size * m_row_count);
+
+    for (int i = 0; i < m_row_count; i++)
+    {
+        for (int j = 0; j < m_row_size; j++)
+        {
+            cells[(i * m_row_size) + j] = getCell(j, i);
+        }
+    }
+}
+
+/* Algorithm - Return m_row_size
+ *
+ */
+int BoardView::getRowSize() const
+{
+    return m_row_size;
+}
+
+/* Algorithm - Return m_row_count
+ *
+ */
+int BoardView::getRowCount() const
+{
+    return m_row_count;
+}
+
+/* Algorithm - Return m_row_stride
+ *
+ */
+int BoardView::getRowStride() const
+{
+    return m_row_stride;
+}
+
+/* Algorithm - Return m_cells
+ *
+ */
+const char *BoardView::getCells() const
+{
+    return m_cells;
+}
+
+/* Algorithm - Return true if m_packed_cells is set
+ *
+ */
+bool BoardView::isPacked() const
+{
+    return (m_packed_cells != NULL);
+}
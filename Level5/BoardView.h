@@ -0,0 +1,162 @@
+#ifndef BOARD_VIEW_H
+#define BOARD_VIEW_H
+
+/*              Author: Michael Marven
+ *        Date Created: 10/17/26
+ *  Date Last Modified: 10/17/26
+ *
+ */
+
+#include <vector>
+
+#include "CommonDefs.h"
+
+/* Brief desc. - A read only view of a Knight Board held in one contiguous, row
+ *               major buffer of node type chars
+ * Details     - The view does not own the buffer; The buffer must outlive
+ *               every view of it and must not change while it is viewed
+ *             - Row y starts at y * row_stride; The row stride may be larger
+ *               than the row size, so a text board with a line ending after
+ *               each row, such as one mapped from a file, can be viewed in
+ *               place without a copy
+ *             - A packed board holds a 3 bit code (see NODE_TYPES) per node
+ *               instead of a char; The code of node n is bits 3n to 3n + 2 of
+ *               the buffer, counting from bit 0 of the first byte, and the
+ *               buffer has one byte after the last code
+ *
+ */
+class BoardView
+{
+public:
+
+    // Constructors
+    BoardView();
+
+    BoardView(const char *cells, int row_size, int row_count, int row_stride);
+
+    // Destructor
+    ~BoardView();
+
+    /* Brief desc.      - A method to copy a board of rows into a contiguous,
+     *                    row major buffer and return a view of it
+     * param[in] board  - A 2D Vector of chars to represent the board
+     * param[out] cells - Vector of chars to receive the buffer; The view is
+     *                    invalidated if cells is changed or destroyed
+     *
+     * param[out]       - Returns a view of cells
+     *
+     */
+    static BoardView fromRows(const std::vector<std::vector<char> > &board,
+        std::vector<char> &cells);
+
+    /* Brief desc.            - A method to return a view of a packed board
+     * param[in] packed_cells - Buffer of 3 bit node type codes
+     * param[in] row_size     - Number of nodes in a row
+     * param[in] row_count    - Number of rows
+     *
+     * param[out]             - Returns a view of packed_cells
+     *
+     */
+    static BoardView fromPacked(const unsigned char *packed_cells, 
+        int row_size, int row_count);
+
+    /* Brief desc.            - A method to check the codes of a range of nodes
+     *                          of a packed board
+     * param[in] packed_cells - Buffer of 3 bit node type codes
+     * param[in] first        - Number of the first node to check
+     * param[in] end          - Number of the node after the last to check
+     *
+     * param[out]             - Returns the number of teleport nodes in the 
+     *                          range, or -1 if a code is not a node type
+     *
+     */
+    static int checkPackedCodes(const unsigned char *packed_cells, int first,
+        int end);
+
+    /* Brief desc.       - A method to pack the board into 3 bit node type
+     *                     codes
+     * param[out] packed - Vector to receive the packed buffer, including the
+     *                     byte after the last code
+     *
+     * Note              - A char that is not a node type is packed as a rock
+     *
+     */
+    void pack(std::vector<unsigned char> &packed) const;
+
+    /* Brief desc.      - A method to copy the board into a contiguous, row
+     *                    major buffer of chars with no gap between rows
+     * param[out] cells - Vector to receive the buffer
+     *
+     */
+    void copyCells(std::vector<char> &cells) const;
+
+    /* Brief desc. - A method to retrieve the node type char of a position
+     * param[in] x - X coordinate of the position
+     * param[in] y - Y coordinate of the position
+     *
+     * param[out]  - Returns the node type char
+     *
+     * Note        - The position is not checked against the board edges
+     *
+     */
+    char getCell(int x, int y) const
+    {
+        if (m_packed_cells)
+        {
+            int bit = ((y * m_row_size) + x) * 3;
+            const unsigned char *code = m_packed_cells + (bit >> 3);
+
+            return NODE_TYPES[((code[0] | (code[1] << 8)) >> (bit & 7)) & 7];
+        }
+
+        return m_cells[(y * m_row_stride) + x];
+    }
+
+    /* Brief desc. - A method to retrieve the number of nodes in a row
+     * param[out]  - Returns the row size
+     *
+     */
+    int getRowSize() const;
+
+    /* Brief desc. - A method to retrieve the number of rows
+     * param[out]  - Returns the row count
+     *
+     */
+    int getRowCount() const;
+
+    /* Brief desc. - A method to retrieve the distance between the starts of two
+     *               consecutive rows in the buffer
+     * param[out]  - Returns the row stride
+     *
+     */
+    int getRowStride() const;
+
+    /* Brief desc. - A method to retrieve the start of the viewed buffer
+     * param[out]  - Returns a pointer to the node type char of position (0, 0),
+     *               or NULL if the board is packed
+     *
+     */
+    const char *getCells() const;
+
+    /* Brief desc. - A method to check if the board is packed
+     * param[out]  - Returns true if the board holds 3 bit node type codes
+     *
+     */
+    bool isPacked() const;
+
+private:
+
+    // Attributes
+    const char *m_cells;
+
+    const unsigned char *m_packed_cells;
+
+    int m_row_size;
+
+    int m_row_count;
+
+    int m_row_stride;
+
+};
+
+#endif // BOARD_VIEW_H
@@ -3,7 +3,7 @@
 
 /*              Author: Michael Marven
  *        Date Created: 05/26/17
- *  Date Last Modified: 07/02/17
+ *  Date Last Modified: 10/17/26
  *
  */
 
@@ -12,6 +12,18 @@
 const int WATER_NODE_WEIGHT = 2;
 const int LAVA_NODE_WEIGHT  = 5;
 
+// Knight move directions in clockwise order starting with the 1 o'clock 
+// position, followed by 2:00, 4:00, 5:00, 7:00, 8:00, 10:00, 11:00; Bit i of a
+// legal move mask corresponds to direction i
+const int KNIGHT_MOVE_COUNT = 8;
+const int KNIGHT_MOVE_X[KNIGHT_MOVE_COUNT] = { 1,  2, 2, 1, -1, -2, -2, -1};
+const int KNIGHT_MOVE_Y[KNIGHT_MOVE_COUNT] = {-2, -1, 1, 2,  2,  1, -1, -2};
+
+// Node type chars indexed by their 3 bit code in a packed board; Codes 6 and 7
+// are not used
+const int  NODE_TYPE_COUNT = 6;
+const char NODE_TYPES[8]   = {'.', 'W', 'L', 'R', 'B', 'T', '?', '?'};
+
 
 /* Brief desc.          - A struct to hold information for nodes in the Knight  
  *                        Board graphs
@@ -0,0 +1,468 @@
+/*              Author: Michael Marven
+ *        Date Created: 10/17/26
+ *  Date Last Modified: 10/17/26
+ *
+ */
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <algorithm>
+#include <limits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "GraphFile.h"
+#include "BoardFile.h"
+
+// The sections store int32_t values that are used in place as ints
+static_assert(sizeof(int) == 4, "GraphFile requires a 32 bit int");
+
+GraphFile::GraphFile()
+    : m_data(NULL),
+    m_size(0),
+    m_move_masks(NULL),
+    m_adj_offsets(NULL),
+    m_adj_targets(NULL),
+    m_adj_weights(NULL),
+    m_edge_count(0),
+    m_node_count(0),
+    m_table_starts(NULL),
+    m_tables(NULL),
+    m_table_count(0)
+{
+    // Empty
+}
+
+GraphFile::~GraphFile()
+{
+    unload();
+}
+
+/* Algorithm - Unmap a graph loaded earlier
+ *           - Open the file, find its size and map it read only
+ *           - Check the magic, version and counts in the header before sizing 
+ *             the sections, so the sizes cannot overflow; The node number of 
+ *             every bit code of the board must fit in an int, a node has at 
+ *             most 8 edges and each table has a different start node
+ *           - The file size must match the sizes of the sections
+ *           - Check the checksum of the words after the header if requested
+ *           - Point the sections into the mapped bytes and check them with 
+ *             checkSections()
+ *
+ */
+bool GraphFile::load(const char *file_name, bool check_checksum)
+{
+    unload();
+
+    int fd = open(file_name, O_RDONLY);
+    if (fd == -1)
+    {
+        std::cout << "Graph file " << file_name << " could not be opened.\n";
+        return false;
+    }
+
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) == -1
+        || file_stat.st_size < static_cast<off_t>(sizeof(GraphFileHeader)))
+    {
+        std::cout << "Graph file " << file_name << " is too small.\n";
+        close(fd);
+        return false;
+    }
+
+    void *data = mmap(NULL, file_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+
+    if (data == MAP_FAILED)
+    {
+        std::cout << "Graph file " << file_name << " could not be mapped.\n";
+        return false;
+    }
+
+    m_data = static_cast<const char *>(data);
+    m_size = file_stat.st_size;
+
+    const GraphFileHeader *header =
+        reinterpret_cast<const GraphFileHeader *>(m_data);
+
+    uint64_t node_count = static_cast<uint64_t>(header->row_size)
+        * header->row_count;
+    uint64_t max_int    = std::numeric_limits<int>::max();
+
+    if (memcmp(header->magic, "KGRF", 4) != 0
+        || header->version != GRAPH_FILE_VERSION || node_count == 0
+        || node_count > max_int / 3 || header->edge_count > max_int
+        || header->edge_count > node_count * KNIGHT_MOVE_COUNT
+        || header->table_count > node_count)
+    {
+        std::cout << "Graph file " << file_name << " is not a valid graph.\n";
+        unload();
+        return false;
+    }
+
+    uint64_t sizes[5];
+    uint64_t body_size = getSectionSizes(node_count, header->edge_count,
+        header->table_count, sizes);
+
+    if (m_size != sizeof(GraphFileHeader) + body_size)
+    {
+        std::cout << "Graph file " << file_name << " is not a valid graph.\n";
+        unload();
+        return false;
+    }
+
+    const char *body = m_data + sizeof(GraphFileHeader);
+    if (check_checksum && BoardFile::calcChecksum(
+        reinterpret_cast<const uint64_t *>(body), body_size / 8)
+            != header->checksum)
+    {
+        std::cout << "Graph file " << file_name << " has a bad checksum.\n";
+        unload();
+        return false;
+    }
+
+    // Point the sections into the mapped bytes
+    m_node_count   = node_count;
+    m_edge_count   = header->edge_count;
+    m_table_count  = header->table_count;
+    m_board        = BoardView::fromPacked(
+        reinterpret_cast<const unsigned char *>(body),
+        header->row_size, header->row_count);
+    const unsigned char *packed_cells = 
+        reinterpret_cast<const unsigned char *>(body);
+    body          += sizes[0];
+    m_move_masks   = reinterpret_cast<const uint8_t *>(body);
+    body          += sizes[1];
+    m_adj_offsets  = reinterpret_cast<const int *>(body);
+    m_adj_targets  = m_adj_offsets + m_node_count + 1;
+    m_adj_weights  = m_adj_targets + m_edge_count;
+    body          += sizes[2];
+    m_table_starts = reinterpret_cast<const int *>(body);
+    body          += sizes[3];
+    m_tables       = reinterpret_cast<const int *>(body);
+
+    if (!checkSections(packed_cells))
+    {
+        std::cout << "Graph file " << file_name << " is not a valid graph.\n";
+        unload();
+        return false;
+    }
+
+    return true;
+}
+
+/* Algorithm - Check every code of the packed board with checkPackedCodes(); 
+ *             The board can have no more than two teleport nodes
+ *           - No legal move mask can have a move off the board; Only the masks
+ *             of nodes within 2 nodes of an edge need to be checked
+ *           - The adjacency list offsets must start at 0, give each node 0 to 8
+ *             edges and end at the edge count; Every target must be a node and
+ *             every weight must be from 1 to the heaviest node weight
+ *           - Every table start must be a node; No table distance can be
+ *             negative and every table parent must be a node or -1
+ *           - The values of a section are checked without branching, so the
+ *             loops are vectorized
+ *
+ */
+bool GraphFile::checkSections(const unsigned char *packed_cells) const
+{
+    // Check the board
+    int teleports = BoardView::checkPackedCodes(packed_cells, 0, m_node_count);
+    if (teleports == -1 || teleports > 2)
+    {
+        return false;
+    }
+
+    // Check the legal move masks of the nodes near the edges
+    int row_size  = m_board.getRowSize();
+    int row_count = m_board.getRowCount();
+    for (int y = 0; y < row_count; y++)
+    {
+        bool edge_row = (y < 2 || y >= row_count - 2);
+
+        int x = 0;
+        while (x < row_size)
+        {
+            uint8_t mask = m_move_masks[(y * row_size) + x];
+            for (int d = 0; d < KNIGHT_MOVE_COUNT; d++)
+            {
+                int move_x = x + KNIGHT_MOVE_X[d];
+                int move_y = y + KNIGHT_MOVE_Y[d];
+                if ((mask & (1 << d)) && (move_x < 0 || move_x >= row_size 
+                    || move_y < 0 || move_y >= row_count))
+                {
+                    return false;
+                }
+            }
+
+            // Away from the edges every move stays on the board
+            bool edge_node = (edge_row || x + 1 < 2 || x + 1 >= row_size - 2);
+            x = edge_node ? x + 1 : row_size - 2;
+        }
+    }
+
+    // Check the adjacency list
+    unsigned int node_count = m_node_count;
+    int          max_weight = std::max(1, 
+        std::max(WATER_NODE_WEIGHT, LAVA_NODE_WEIGHT));
+    int          invalid    = 0;
+
+    for (int n = 0; n < m_node_count; n++)
+    {
+        long long edges = static_cast<long long>(m_adj_offsets[n + 1]) 
+            - m_adj_offsets[n];
+        invalid += (edges < 0) | (edges > KNIGHT_MOVE_COUNT);
+    }
+
+    for (int e = 0; e < m_edge_count; e++)
+    {
+        invalid += (static_cast<unsigned int>(m_adj_targets[e]) >= node_count)
+            | (m_adj_weights[e] < 1) | (m_adj_weights[e] > max_weight);
+    }
+
+    if (invalid != 0 || m_adj_offsets[0] != 0 
+        || m_adj_offsets[m_node_count] != m_edge_count)
+    {
+        return false;
+    }
+
+    // Check the distance tables
+    for (int t = 0; t < m_table_count; t++)
+    {
+        const int *distances = getTableDistances(t);
+        const int *parents   = getTableParents(t);
+
+        invalid += (static_cast<unsigned int>(m_table_starts[t]) >= node_count);
+        for (int n = 0; n < m_node_count; n++)
+        {
+            invalid += (distances[n] < 0) 
+                | (static_cast<unsigned int>(parents[n]) + 1 > node_count);
+        }
+    }
+
+    return (invalid == 0);
+}
+
+/* Algorithm - Read the first 4 bytes of the file and compare them with the
+ *             magic
+ *
+ */
+bool GraphFile::isGraphFile(const char *file_name)
+{
+    std::ifstream file(file_name, std::ios::binary);
+    char magic[4] = {0, 0, 0, 0};
+
+    file.read(magic, 4);
+
+    return (file && memcmp(magic, "KGRF", 4) == 0);
+}
+
+/* Algorithm - Pack the board
+ *           - Copy each section into a body of words, each section padded with
+ *             zeros to a multiple of 8 bytes
+ *           - Fill in the header with the checksum of the body, then write the
+ *             header and the body
+ *
+ */
+bool GraphFile::write(const char *file_name, const BoardView &board,
+    const uint8_t *move_masks, const int *adj_offsets,
+    const int *adj_targets, const int *adj_weights, int edge_count,
+    const std::vector<int> &table_starts,
+    const std::vector<std::vector<int> > &distances,
+    const std::vector<std::vector<int> > &parents)
+{
+    uint64_t node_count  = static_cast<uint64_t>(board.getRowSize())
+        * board.getRowCount();
+    uint64_t table_count = table_starts.size();
+    uint64_t sizes[5];
+    uint64_t body_size   = getSectionSizes(node_count, edge_count, table_count,
+        sizes);
+
+    std::vector<unsigned char> packed;
+    board.pack(packed);
+
+    std::vector<uint64_t> body(body_size / 8, 0);
+    char *section = reinterpret_cast<char *>(&body[0]);
+
+    memcpy(section, &packed[0], packed.size());
+    section += sizes[0];
+    memcpy(section, move_masks, node_count);
+    section += sizes[1];
+    memcpy(section, adj_offsets, (node_count + 1) * 4);
+    if (edge_count > 0)
+    {
+        memcpy(section + ((node_count + 1) * 4), adj_targets, edge_count * 4);
+        memcpy(section + ((node_count + 1 + edge_count) * 4), adj_weights,
+            edge_count * 4);
+    }
+    section += sizes[2];
+    for (uint64_t t = 0; t < table_count; t++)
+    {
+        memcpy(section + (t * 4), &table_starts[t], 4);
+    }
+    section += sizes[3];
+    for (uint64_t t = 0; t < table_count; t++)
+    {
+        memcpy(section + (t * node_count * 8), &distances[t][0],
+            node_count * 4);
+        memcpy(section + (t * node_count * 8) + (node_count * 4),
+            &parents[t][0], node_count * 4);
+    }
+
+    GraphFileHeader header;
+    memcpy(header.magic, "KGRF", 4);
+    header.version     = GRAPH_FILE_VERSION;
+    header.row_size    = board.getRowSize();
+    header.row_count   = board.getRowCount();
+    header.edge_count  = edge_count;
+    header.table_count = table_count;
+    header.checksum    = BoardFile::calcChecksum(&body[0], body.size());
+
+    std::ofstream file(file_name, std::ios::binary);
+    if (!file)
+    {
+        std::cout << "Graph file " << file_name << " could not be opened.\n";
+        return false;
+    }
+
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char *>(&body[0]), body_size);
+
+    return static_cast<bool>(file);
+}
+
+/* Algorithm - Return m_board
+ *
+ */
+BoardView GraphFile::getBoard() const
+{
+    return m_board;
+}
+
+/* Algorithm - Return m_move_masks
+ *
+ */
+const uint8_t *GraphFile::getMoveMasks() const
+{
+    return m_move_masks;
+}
+
+/* Algorithm - Return m_adj_offsets
+ *
+ */
+const int *GraphFile::getAdjOffsets() const
+{
+    return m_adj_offsets;
+}
+
+/* Algorithm - Return m_adj_targets
+ *
+ */
+const int *GraphFile::getAdjTargets() const
+{
+    return m_adj_targets;
+}
+
+/* Algorithm - Return m_adj_weights
+ *
+ */
+const int *GraphFile::getAdjWeights() const
+{
+    return m_adj_weights;
+}
+
+/* Algorithm - Return m_edge_count
+ *
+ */
+int GraphFile::getEdgeCount() const
+{
+    return m_edge_count;
+}
+
+/* Algorithm - Loop through the table start nodes and return the index of the
+ *             first that matches
+ *
+ */
+int GraphFile::findTable(int start_number) const
+{
+    for (int t = 0; t < m_table_count; t++)
+    {
+        if (m_table_starts[t] == start_number)
+        {
+            return t;
+        }
+    }
+
+    return -1;
+}
+
+/* Algorithm - Return the start of the distances of the table
+ *
+ */
+const int *GraphFile::getTableDistances(int table) const
+{
+    return m_tables + (static_cast<size_t>(table) * m_node_count * 2);
+}
+
+/* Algorithm - Return the start of the parent nodes of the table, which follow
+ *             its distances
+ *
+ */
+const int *GraphFile::getTableParents(int table) const
+{
+    return getTableDistances(table) + m_node_count;
+}
+
+/* Algorithm - Size each section and round it up to a multiple of 8 bytes
+ *           - Return the sum of the sizes
+ *
+ */
+uint64_t GraphFile::getSectionSizes(uint64_t node_count, uint64_t edge_count,
+    uint64_t table_count, uint64_t *sizes)
+{
+    sizes[0] = (((node_count * 3) + 7) / 8) + 1;
+    sizes[1] = node_count;
+    sizes[2] = (node_count + 1 + (edge_count * 2)) * 4;
+    sizes[3] = table_count * 4;
+    sizes[4] = table_count * node_count * 8;
+
+    uint64_t total = 0;
+    for (int i = 0; i < 5; i++)
+    {
+        sizes[i] = (sizes[i] + 7) / 8 * 8;
+        total   += sizes[i];
+    }
+
+    return total;
+}
+
+/* Algorithm - Unmap the file if one is mapped and clear the sections
+ *
+ */
+void GraphFile::unload()
+{
+    if (m_data)
+    {
+        munmap(const_cast<char *>(m_data), m_size);
+    }
+
+    m_data         = NULL;
+    m_size         = 0;
+    m_board        = BoardView();
+    m_move_masks   = NULL;
+    m_adj_offsets  = NULL;
+    m_adj_targets  = NULL;
+    m_adj_weights  = NULL;
+    m_edge_count   = 0;
+    m_node_count   = 0;
+    m_table_starts = NULL;
+    m_tables       = NULL;
+    m_table_count  = 0;
+}
@@ -0,0 +1,246 @@
+#ifndef GRAPH_FILE_H
+#define GRAPH_FILE_H
+
+/*              Author: Michael Marven
+ *        Date Created: 10/17/26
+ *  Date Last Modified: 10/17/26
+ *
+ */
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+#include "BoardView.h"
+
+// Version of the graph file format
+const uint32_t GRAPH_FILE_VERSION = 1;
+
+/* Brief desc.           - A struct for the header of a graph file
+ * param     magic       - "KGRF"
+ * param     version     - GRAPH_FILE_VERSION
+ * param     row_size    - Number of nodes in a row
+ * param     row_count   - Number of rows
+ * param     edge_count  - Number of edges in the adjacency list
+ * param     table_count - Number of start nodes with distance tables
+ * param     checksum    - Checksum of the bytes after the header
+ *
+ * Details               - The header is followed by these sections, each
+ *                         padded with zeros to a multiple of 8 bytes:
+ *                           - The packed board (see BoardView)
+ *                           - One legal move mask per node
+ *                           - The CSR adjacency list of every node on the
+ *                             board: node_count + 1 offsets, then edge_count
+ *                             targets, then edge_count weights
+ *                           - The start node number of each distance table
+ *                           - For each table, the distance and then the parent
+ *                             node number of every node from the start node
+ *                       - Numbers are stored as int32_t in the byte order of
+ *                         the host
+ *
+ */
+struct GraphFileHeader
+{
+    char     magic[4];
+    uint32_t version;
+    uint32_t row_size;
+    uint32_t row_count;
+    uint32_t edge_count;
+    uint32_t table_count;
+    uint64_t checksum;
+};
+
+/* Brief desc. - A graph file of a Knight Board mapped into memory
+ * Details     - A graph file holds the board, the legal move masks and the
+ *               adjacency list a KnightGraph object builds, and optionally the
+ *               shortest path distances and parent nodes from some start
+ *               nodes, so a KnightGraph object can be constructed over it
+ *               without building them again
+ *             - The sections are used in place in the mapped bytes; The
+ *               GraphFile object must outlive the objects constructed over it
+ *
+ */
+class GraphFile
+{
+public:
+
+    // Constructor
+    GraphFile();
+
+    // Destructor
+    ~GraphFile();
+
+    /* Brief desc.              - A method to map a graph file and check it
+     * param[in] file_name      - Name of the graph file
+     * param[in] check_checksum - A flag to indicate whether the checksum of
+     *                            the whole file should be checked
+     *
+     * param[out]               - Returns true if the file was mapped and holds
+     *                            a valid graph; Otherwise prints the reason
+     *                            and returns false
+     *
+     * Note                     - The sections are always checked, so every 
+     *                            node number, offset and weight a search 
+     *                            reads is in range; The checksum also finds
+     *                            changes that leave the sections in range
+     *
+     */
+    bool load(const char *file_name, bool check_checksum);
+
+    /* Brief desc.         - A method to check if a file is a graph file
+     * param[in] file_name - Name of the file
+     *
+     * param[out]          - Returns true if the file starts with the graph
+     *                       file magic
+     *
+     */
+    static bool isGraphFile(const char *file_name);
+
+    /* Brief desc.            - A method to write a graph file
+     * param[in] file_name    - Name of the graph file
+     * param[in] board        - View of the board
+     * param[in] move_masks   - Legal move mask of each node
+     * param[in] adj_offsets  - Offsets of the CSR adjacency list
+     * param[in] adj_targets  - Targets of the CSR adjacency list
+     * param[in] adj_weights  - Weights of the CSR adjacency list
+     * param[in] edge_count   - Number of edges
+     * param[in] table_starts - Start node number of each distance table
+     * param[in] distances    - Distance of each node, for each table
+     * param[in] parents      - Parent node number of each node, for each table
+     *
+     * param[out]             - Returns true if the file was written
+     *
+     */
+    static bool write(const char *file_name, const BoardView &board,
+        const uint8_t *move_masks, const int *adj_offsets,
+        const int *adj_targets, const int *adj_weights, int edge_count,
+        const std::vector<int> &table_starts,
+        const std::vector<std::vector<int> > &distances,
+        const std::vector<std::vector<int> > &parents);
+
+    /* Brief desc. - A method to retrieve the view of the packed board
+     * param[out]  - Returns the view; The view is empty if no graph is loaded
+     *
+     */
+    BoardView getBoard() const;
+
+    /* Brief desc. - A method to retrieve the legal move masks
+     * param[out]  - Returns a pointer to the mask of node 0
+     *
+     */
+    const uint8_t *getMoveMasks() const;
+
+    /* Brief desc. - A method to retrieve the offsets of the adjacency list
+     * param[out]  - Returns a pointer to node_count + 1 offsets
+     *
+     */
+    const int *getAdjOffsets() const;
+
+    /* Brief desc. - A method to retrieve the targets of the adjacency list
+     * param[out]  - Returns a pointer to edge_count targets
+     *
+     */
+    const int *getAdjTargets() const;
+
+    /* Brief desc. - A method to retrieve the weights of the adjacency list
+     * param[out]  - Returns a pointer to edge_count weights
+     *
+     */
+    const int *getAdjWeights() const;
+
+    /* Brief desc. - A method to retrieve the number of edges
+     * param[out]  - Returns the edge count
+     *
+     */
+    int getEdgeCount() const;
+
+    /* Brief desc.            - A method to find the distance table of a start
+     *                          node
+     * param[in] start_number - Number of the start node
+     *
+     * param[out]             - Returns the index of the table, or -1 if the
+     *                          start node has no table
+     *
+     */
+    int findTable(int start_number) const;
+
+    /* Brief desc.     - A method to retrieve the distances of a table
+     * param[in] table - Index of the table
+     *
+     * param[out]      - Returns a pointer to the distance of node 0; Nodes
+     *                   not reachable have a distance of the max int
+     *
+     */
+    const int *getTableDistances(int table) const;
+
+    /* Brief desc.     - A method to retrieve the parent nodes of a table
+     * param[in] table - Index of the table
+     *
+     * param[out]      - Returns a pointer to the parent node number of node 0;
+     *                   The start node and nodes not reachable have -1
+     *
+     */
+    const int *getTableParents(int table) const;
+
+private:
+
+    // Not copyable, as the mapping is unmapped by the destructor
+    GraphFile(const GraphFile &other);
+    GraphFile &operator=(const GraphFile &other);
+
+    /* Brief desc.           - A method to compute the padded size of each
+     *                         section of a graph file
+     * param[in] node_count  - Number of nodes
+     * param[in] edge_count  - Number of edges
+     * param[in] table_count - Number of distance tables
+     * param[out] sizes      - Array to receive the sizes of the board, mask,
+     *                         adjacency list, table start and table sections
+     *
+     * param[out]            - Returns the total size of the sections
+     *
+     */
+    static uint64_t getSectionSizes(uint64_t node_count, uint64_t edge_count,
+        uint64_t table_count, uint64_t *sizes);
+
+    /* Brief desc.            - A method to check that the values of the 
+     *                          mapped sections are in range
+     * param[in] packed_cells - Packed board of the file
+     *
+     * param[out]             - Returns true if every value is in range
+     *
+     */
+    bool checkSections(const unsigned char *packed_cells) const;
+
+    /* Brief desc. - A method to unmap the file and clear the sections
+     *
+     */
+    void unload();
+
+    // Attributes
+    const char *m_data;
+
+    size_t m_size;
+
+    BoardView m_board;
+
+    const uint8_t *m_move_masks;
+
+    const int *m_adj_offsets;
+
+    const int *m_adj_targets;
+
+    const int *m_adj_weights;
+
+    int m_edge_count;
+
+    int m_node_count;
+
+    const int *m_table_starts;
+
+    const int *m_tables;
+
+    int m_table_count;
+
+};
+
+#endif // GRAPH_FILE_H
@@ -0,0 +1,204 @@
+/*              Author: Michael Marven
+ *        Date Created: 10/17/26
+ *  Date Last Modified: 10/17/26
+ *
+ */
+
+#include <vector>
+
+#include "IndexedHeap.h"
+
+IndexedHeap::IndexedHeap()
+{
+    // Empty
+}
+
+IndexedHeap::~IndexedHeap()
+{
+    // Empty
+}
+
+/* Algorithm - Clear the positions of the nodes remaining in the heap, then 
+ *             clear the heap
+ *           - Grow the position and key storage if capacity exceeds it
+ * 
+ */
+void IndexedHeap::reset(int capacity)
+{
+    for (unsigned int i = 0; i < m_heap.size(); i++)
+    {
+        m_positions[m_heap[i]] = -1;
+    }
+    m_heap.clear();
+
+    if (static_cast<int>(m_positions.size()) < capacity)
+    {
+        m_positions.resize(capacity, -1);
+        m_keys.resize(capacity, 0);
+        m_heap.reserve(capacity);
+    }
+}
+
+/* Algorithm - Return true if m_heap has no nodes
+ * 
+ */
+bool IndexedHeap::empty()
+{
+    return m_heap.empty();
+}
+
+/* Algorithm - Return true if the node has a position in m_heap
+ * 
+ */
+bool IndexedHeap::contains(int number)
+{
+    return (m_positions[number] != -1);
+}
+
+/* Algorithm - Return the key of the node
+ * 
+ */
+int IndexedHeap::getKey(int number)
+{
+    return m_keys[number];
+}
+
+/* Algorithm - If the node is not in the heap, add it at the bottom of the heap
+ *             and sift it up
+ *           - If the node is in the heap with a larger key, lower its key and 
+ *             sift it up from its current position
+ * 
+ */
+void IndexedHeap::pushOrDecrease(int number, int key)
+{
+    if (!contains(number))
+    {
+        m_keys[number] = key;
+        m_heap.push_back(number);
+        m_positions[number] = m_heap.size() - 1;
+        siftUp(m_heap.size() - 1);
+    }
+    else if (key < m_keys[number])
+    {
+        m_keys[number] = key;
+        siftUp(m_positions[number]);
+    }
+}
+
+/* Algorithm - Return the node at the top of the heap
+ * 
+ */
+int IndexedHeap::top()
+{
+    return m_heap[0];
+}
+
+/* Algorithm - Remove the node at the top of the heap
+ *           - Move the last node to the top and sift it down
+ * 
+ */
+int IndexedHeap::pop()
+{
+    int top  = m_heap[0];
+    int last = m_heap.back();
+
+    m_heap.pop_back();
+    m_positions[top] = -1;
+
+    if (!m_heap.empty())
+    {
+        place(0, last);
+        siftDown(0);
+    }
+
+    return top;
+}
+
+/* Algorithm - While the node is less than its parent, move the parent down 
+ *             into the node's index and continue from the parent's index
+ *           - Place the node at the final index
+ * 
+ */
+void IndexedHeap::siftUp(int index)
+{
+    int number = m_heap[index];
+
+    while (index > 0)
+    {
+        int parent = (index - 1) / ARITY;
+
+        if (!isLess(number, m_heap[parent]))
+        {
+            break;
+        }
+
+        place(index, m_heap[parent]);
+        index = parent;
+    }
+
+    place(index, number);
+}
+
+/* Algorithm - Find the least of the node's children; While that child is less
+ *             than the node, move the child up into the node's index and 
+ *             continue from the child's index
+ *           - Place the node at the final index
+ * 
+ */
+void IndexedHeap::siftDown(int index)
+{
+    int number = m_heap[index];
+    int size   = m_heap.size();
+
+    while (true)
+    {
+        int first_child = (index * ARITY) + 1;
+        if (first_child >= size)
+        {
+            break;
+        }
+
+        // Find the least child
+        int least_child = first_child;
+        int last_child  = first_child + ARITY;
+        if (last_child > size)
+        {
+            last_child = size;
+        }
+        for (int child = first_child + 1; child < last_child; child++)
+        {
+            if (isLess(m_heap[child], m_heap[least_child]))
+            {
+                least_child = child;
+            }
+        }
+
+        if (!isLess(m_heap[least_child], number))
+        {
+            break;
+        }
+
+        place(index, m_heap[least_child]);
+        index = least_child;
+    }
+
+    place(index, number);
+}
+
+/* Algorithm - Compare keys; If the keys are equal, compare node numbers
+ * 
+ */
+bool IndexedHeap::isLess(int first, int second)
+{
+    return (m_keys[first] < m_keys[second]) 
+        || (m_keys[first] == m_keys[second] && first < second);
+}
+
+/* Algorithm - Store the node at the index and record the index
+ * 
+ */
+void IndexedHeap::place(int index, int number)
+{
+    m_heap[index]       = number;
+    m_positions[number] = index;
+}
@@ -0,0 +1,127 @@
+#ifndef INDEXED_HEAP_H
+#define INDEXED_HEAP_H
+
+/*              Author: Michael Marven
+ *        Date Created: 10/17/26
+ *  Date Last Modified: 10/17/26
+ *
+ */
+
+#include <vector>
+
+class IndexedHeap
+{
+public:
+
+    // Constructor
+    IndexedHeap();
+
+    // Destructor
+    ~IndexedHeap();
+
+    /* Brief desc.        - A method to empty the heap and prepare it for node
+     *                      numbers less than capacity
+     * param[in] capacity - Number of nodes that may be placed in the heap
+     *
+     * Note               - Storage is kept between uses, so resetting a heap 
+     *                      that was used for the same number of nodes does not
+     *                      allocate
+     *
+     */
+    void reset(int capacity);
+
+    /* Brief desc. - A method to check if the heap is empty
+     * param[out]  - Returns true if the heap contains no nodes
+     *
+     */
+    bool empty();
+
+    /* Brief desc.      - A method to check if a node is in the heap
+     * param[in] number - Number of the node
+     *
+     * param[out]       - Returns true if the node is in the heap
+     *
+     */
+    bool contains(int number);
+
+    /* Brief desc.      - A method to retrieve the key of a node in the heap
+     * param[in] number - Number of the node
+     *
+     * param[out]       - Returns the key of the node
+     *
+     */
+    int getKey(int number);
+
+    /* Brief desc.      - A method to place a node in the heap, or lower its key
+     *                    if it is already in the heap
+     * param[in] number - Number of the node
+     * param[in] key    - Key of the node
+     *
+     * Note             - A key larger than the current key of a node in the 
+     *                    heap is ignored
+     *
+     */
+    void pushOrDecrease(int number, int key);
+
+    /* Brief desc. - A method to retrieve the node with the min key without 
+     *               removing it from the heap
+     * param[out]  - Returns the number of the node with the min key
+     *
+     */
+    int top();
+
+    /* Brief desc. - A method to remove the node with the min key from the heap
+     * param[out]  - Returns the number of the removed node
+     *
+     * Note        - Nodes with equal keys are removed in order of node number
+     *
+     */
+    int pop();
+
+private:
+
+    /* Brief desc.     - A method to move a node up the heap until its parent is
+     *                   not greater than it
+     * param[in] index - Index of the node in m_heap
+     *
+     */
+    void siftUp(int index);
+
+    /* Brief desc.     - A method to move a node down the heap until none of its
+     *                   children are less than it
+     * param[in] index - Index of the node in m_heap
+     *
+     */
+    void siftDown(int index);
+
+    /* Brief desc.      - A method to compare two nodes by key, then by number
+     * param[in] first  - Number of the first node
+     * param[in] second - Number of the second node
+     *
+     * param[out]       - Returns true if the first node is less than the second
+     *
+     */
+    bool isLess(int first, int second);
+
+    /* Brief desc.      - A method to place a node at an index of m_heap and 
+     *                    record the index in m_positions
+     * param[in] index  - Index in m_heap
+     * param[in] number - Number of the node
+     *
+     */
+    void place(int index, int number);
+
+    // Attributes
+    static const int ARITY = 4;
+
+    // Node numbers in heap order
+    std::vector<int> m_heap;
+
+    // Index of each node in m_heap, or -1 if the node is not in the heap
+    std::vector<int> m_positions;
+
+    // Key of each node, valid while the node is in the heap
+    std::vector<int> m_keys;
+};
+
+#endif // INDEXED_HEAP_H
@@ -1,6 +1,6 @@
 /*              Author: Michael Marven
  *        Date Created: 05/30/17
- *  Date Last Modified: 07/02/17
+ *  Date Last Modified: 10/17/26
  *
  */
 
@@ -8,30 +8,79 @@
 #include <algorithm>
 #include <numeric>
 #include <vector>
-#include <deque>
 #include <queue>
 #include <random>
+#include <cstdlib>
+#include <thread>
+#include <functional>
+#include <chrono>
 
 #include "KnightGraph.h"
 
-KnightGraph::KnightGraph(std::vector<std::vector<char> > board)
+KnightGraph::KnightGraph(const std::vector<std::vector<char> > &board)
+    : m_board(BoardView::fromRows(board, m_board_cells)),
+    m_board_row_size(m_board.getRowSize()),
+    m_node_count(m_board.getRowCount() * m_board.getRowSize()),
+    m_teleport_one(-1),
+    m_teleport_two(-1),
+    m_expanded_count(0),
+    m_generation(0),
+    m_node_stamps(m_node_count, 0),
+    m_graph_file(NULL),
+    m_adj_offsets(m_node_count + 1, 0),
+    m_csr_offsets(NULL),
+    m_csr_targets(NULL),
+    m_csr_weights(NULL),
+    m_csr_edge_count(0),
+    m_path_node_bound(0),
+    m_bound_reached(false),
+    m_rollout_pruning(false)
+{
+    initGraph();
+}
+
+KnightGraph::KnightGraph(const BoardView &board)
     : m_board(board),
-    m_board_row_size(m_board[0].size()),
-    m_node_count(m_board.size() * m_board[0].size()),
-    m_adj_matrix(m_node_count, std::vector<int>(m_node_count, 0))
+    m_board_row_size(m_board.getRowSize()),
+    m_node_count(m_board.getRowCount() * m_board.getRowSize()),
+    m_teleport_one(-1),
+    m_teleport_two(-1),
+    m_expanded_count(0),
+    m_generation(0),
+    m_node_stamps(m_node_count, 0),
+    m_graph_file(NULL),
+    m_adj_offsets(m_node_count + 1, 0),
+    m_csr_offsets(NULL),
+    m_csr_targets(NULL),
+    m_csr_weights(NULL),
+    m_csr_edge_count(0),
+    m_path_node_bound(0),
+    m_bound_reached(false),
+    m_rollout_pruning(false)
 {
-    // Construct vector of Vertex structs
-    for (unsigned int i = 0; i < m_board.size(); i++)
-    {
-        for (unsigned int j = 0; j < m_board[0].size(); j++)
-        {
-            Vertex vert(j, i, m_board_row_size);
-            m_nodes.push_back(vert);
-        }
-    }
+    initGraph();
+}
 
-    // Initialize MoveValidator object
-    m_validator = new MoveValidator(board);
+KnightGraph::KnightGraph(const GraphFile &graph_file)
+    : m_board(graph_file.getBoard()),
+    m_board_row_size(m_board.getRowSize()),
+    m_node_count(m_board.getRowCount() * m_board.getRowSize()),
+    m_teleport_one(-1),
+    m_teleport_two(-1),
+    m_expanded_count(0),
+    m_generation(0),
+    m_node_stamps(m_node_count, 0),
+    m_graph_file(&graph_file),
+    m_adj_offsets(m_node_count + 1, 0),
+    m_csr_offsets(NULL),
+    m_csr_targets(NULL),
+    m_csr_weights(NULL),
+    m_csr_edge_count(0),
+    m_path_node_bound(0),
+    m_bound_reached(false),
+    m_rollout_pruning(false)
+{
+    initGraph();
 }
 
 KnightGraph::~KnightGraph()
@@ -40,10 +89,20 @@ KnightGraph::~KnightGraph()
     {
         delete m_validator;
     }
+
+    if (m_bitboard)
+    {
+        delete m_bitboard;
+    }
 }
 
 /* Algorithm - Confirm that the start node is on the board
- *           - Call dfsVisitNext() to use a DFS to build the adjacency matrix 
+ *           - Clear the visited status left in m_nodes by an earlier search
+ *           - Return if the graph was constructed over a graph file, as its 
+ *             adjacency list already holds every node
+ *           - Call dfsVisitNext() to use a DFS to visit the reachable nodes
+ *           - Call buildAdjacencyList() to pack the edges of the visited nodes
+ *             into the CSR adjacency list
  *           - Reset the visited status for all nodes in m_nodes
  * 
  */
@@ -59,9 +118,24 @@ void KnightGraph::dfsGraphBuild(int start_x, int start_y)
         return;
     }
 
-    // Call visitNext() to use DFS to build adjacency matrix
+    // Clear visited status left by an earlier search
+    for (unsigned int i = 0; i < m_nodes.size(); i++)
+    {
+        m_nodes[i].visited = false;
+    }
+
+    // The adjacency list of a graph file is used as is
+    if (m_graph_file)
+    {
+        return;
+    }
+
+    // Call visitNext() to use DFS to visit the reachable nodes
     dfsVisitNext(start_x, start_y);
 
+    // Build the adjacency list from the visited nodes
+    buildAdjacencyList();
+
     // Reset visited status for all nodes
     for (unsigned int i = 0; i < m_nodes.size(); i++)
     {
@@ -70,10 +144,10 @@ void KnightGraph::dfsGraphBuild(int start_x, int start_y)
 }
 
 /* Algorithm - Confirm the start and end points are on the board
- *           - Call dfsGraphBuild() to build the adjacency matrix
+ *           - Call dfsGraphBuild() to build the adjacency list
  *           - Use BFS to retrieve a shortest path to the end node
  *             - Enqueue the first node in a FIFO queue
- *             - While the node queue contains nodes, check the adjacency matrix
+ *             - While the node queue contains nodes, check the adjacency list
  *               for the neighbors of the front node; distance of the neighbors
  *               becomes distance of the current node + 1; the parent of the 
  *               neighbors is changed to the current vertex; Enqueue the current
@@ -85,7 +159,7 @@ void KnightGraph::dfsGraphBuild(int start_x, int start_y)
 void KnightGraph::bfsShortestPath(int start_x, int start_y, 
     int end_x, int end_y)
 {
-    // Verify start and end Vertex structs are on board    
+    // Verify start and end Vertex structs are on board    
     Vertex start(start_x, start_y, m_board_row_size);
     Vertex end(end_x, end_y, m_board_row_size);
     
@@ -97,12 +171,12 @@ void KnightGraph::bfsShortestPath(int start_x, int start_y,
         return;
     }
     
-    // Build the adjacency matrix
+    // Build the adjacency list
     dfsGraphBuild(start_x, start_y);
 
     // Enqueue the start node
-    std::queue<Vertex> node_queue(m_node_queue);
-    node_queue.push(m_nodes[start.number]);
+    std::queue<Vertex> node_queue;
+    node_queue.push(getNode(start.number));
 
     // Conduct BFS search in loop 
     while (!node_queue.empty())
@@ -110,33 +184,28 @@ void KnightGraph::bfsShortestPath(int start_x, int start_y,
         // Get a copy of the front node
         Vertex current = node_queue.front();
 
-        // Check the adjacency matrix for connected nodes
-        for (unsigned int i = 0; i < m_adj_matrix[current.number].size(); i++)
+        // Check the adjacency list for connected nodes
+        for (int e = m_csr_offsets[current.number]; 
+            e < m_csr_offsets[current.number + 1]; e++)
         {
-            if (m_adj_matrix[current.number][i] == 1)
+            if (m_csr_weights[e] == 1)
             {
-                auto result = std::find_if(
-                    m_nodes.begin(), m_nodes.end(), match_num(i));
+                int i = m_csr_targets[e];
 
                 // Update node if it has not been visited
-                if (result != m_nodes.end() && !result->visited)
+                if (!getNode(i).visited)
                 {
-                    result->distance   = current.distance + 1;
-                    result->parent_num = current.number;
+                    getNode(i).distance   = current.distance + 1;
+                    getNode(i).parent_num = current.number;
 
                     // Enqueue the node
-                    node_queue.push(m_nodes[i]);
+                    node_queue.push(getNode(i));
                 }
             }
         }
 
         // Mark current node visited
-        auto result = std::find_if(
-            m_nodes.begin(), m_nodes.end(), match_num(current.number));
-        if (result != m_nodes.end())
-        {
-            result->visited = true;
-        }
+        getNode(current.number).visited = true;
 
         // Dequeue current node
         node_queue.pop();
@@ -146,7 +215,7 @@ void KnightGraph::bfsShortestPath(int start_x, int start_y,
     int node_number = end.number;
     while (node_number != -1)
     {
-        m_path.push_back(m_nodes[node_number]);
+        m_path.push_back(getNode(node_number));
 
         // Set next node number to parent number of the current node
         if (node_number == start.number)
@@ -155,7 +224,7 @@ void KnightGraph::bfsShortestPath(int start_x, int start_y,
         }
         else
         {
-            int next_node_number = m_nodes[node_number].parent_num;
+            int next_node_number = getNode(node_number).parent_num;
             node_number = next_node_number;
         }
     }
@@ -164,26 +233,294 @@ void KnightGraph::bfsShortestPath(int start_x, int start_y,
     std::reverse(m_path.begin(), m_path.end());
 }
 
-/* Algorithm - Call dfsGraphBuild() to build the adjacency matrix
+/* Algorithm - Confirm the start and end points are on the board
+ *           - Reset m_nodes values to defaults and clear m_path
+ *           - Use a bit-parallel BFS to find the level of the end node
+ *             - The start node is the frontier of level 0 and is visited
+ *             - Call BitBoard::expandFrontier() to generate every node 
+ *               reachable from the frontier, then BitBoard::mergeFrontier() to
+ *               keep the passable nodes not yet visited as the next frontier
+ *             - Store the nonzero words of each frontier
+ *             - Stop once the end node is in the frontier or the frontier is 
+ *               empty
+ *           - Recover the parents backward from the end node: the parent of a
+ *             node of level k is a node of level k - 1 that has a legal move to
+ *             it, or to the other teleport node if it is a teleport node
+ *           - Build the path in reverse order from the destination to the 
+ *             source
+ * 
+ */
+void KnightGraph::bitBfsShortestPath(int start_x, int start_y, 
+    int end_x, int end_y)
+{
+    // Verify start and end Vertex structs are on board and legal
+    Vertex start(start_x, start_y, m_board_row_size);
+    Vertex end(end_x, end_y, m_board_row_size);
+
+    if (!startAndEndAreValid(start, end))
+    {
+        std::cout << "Start or end node is invalid.\n";
+        return;
+    }
+
+    // Reset visited, parent, and distance status for all nodes
+    setM_nodeValsToDefaults();
+    m_path.clear();
+
+    int word_count = m_bitboard->getWordCount();
+    const std::vector<uint64_t> &passable = m_bitboard->getPassablePlane();
+
+    std::vector<uint64_t> frontier(word_count, 0);
+    std::vector<uint64_t> visited(word_count, 0);
+    std::vector<uint64_t> reachable(word_count, 0);
+    BitBoard::setBit(frontier, start.number);
+    BitBoard::setBit(visited, start.number);
+
+    m_level_offsets.assign(1, 0);
+    m_level_word_indices.clear();
+    m_level_words.clear();
+    m_expanded_count = 0;
+
+    // Expand one level at a time until the end node is reached
+    int  end_level = -1;
+    bool found     = true;
+    while (found)
+    {
+        // Store the nonzero words of the frontier
+        for (int i = 0; i < word_count; i++)
+        {
+            if (frontier[i] != 0)
+            {
+                m_level_word_indices.push_back(i);
+                m_level_words.push_back(frontier[i]);
+                m_expanded_count += __builtin_popcountll(frontier[i]);
+            }
+        }
+        m_level_offsets.push_back(m_level_words.size());
+
+        if (BitBoard::testBit(frontier, end.number))
+        {
+            end_level = m_level_offsets.size() - 2;
+            found     = false;
+        }
+        else
+        {
+            m_bitboard->expandFrontier(frontier, reachable);
+            found = BitBoard::mergeFrontier(reachable, passable, visited);
+            frontier.swap(reachable);
+        }
+    }
+
+    if (end_level == -1)
+    {
+        return;
+    }
+
+    // Recover the parents from the end node back to the start node
+    int node_number = end.number;
+    getNode(node_number).distance = end_level;
+    getNode(node_number).visited  = true;
+    for (int level = end_level; level > 0; level--)
+    {
+        // A move onto a teleport node lands on the other teleport node
+        int target = node_number;
+        if (node_number == m_teleport_one)
+        {
+            target = m_teleport_two;
+        }
+        else if (node_number == m_teleport_two)
+        {
+            target = m_teleport_one;
+        }
+
+        int parent = -1;
+        for (int d = 0; d < KNIGHT_MOVE_COUNT; d++)
+        {
+            // The opposite direction of direction d is direction d + 4
+            int source = getMoveTarget(target, (d + 4) % KNIGHT_MOVE_COUNT);
+            if (source >= 0 && source < m_node_count 
+                && (m_validator->getLegalMoveMask(source) & (1 << d)) 
+                && levelContains(level - 1, source))
+            {
+                parent = source;
+                d      = KNIGHT_MOVE_COUNT;
+            }
+        }
+
+        getNode(node_number).parent_num = parent;
+        getNode(parent).distance        = level - 1;
+        getNode(parent).visited         = true;
+        node_number = parent;
+    }
+
+    // Build path in reverse order
+    buildPathInReverse(start, end);
+}
+
+/* Algorithm - For each batch of up to 64 starting nodes:
+ *             - Give each valid starting node a bit, set it in the seen and 
+ *               frontier words of its node, and set its distance to 0
+ *             - While the frontier contains nodes, for each frontier node and 
+ *               each of its legal moves, take the bits of the frontier node 
+ *               that have not yet seen the landing node; Add them to the seen 
+ *               word and the next frontier word of the landing node, and set 
+ *               the distance of the landing node for each of those starting 
+ *               nodes to the level + 1
+ *             - Clear the frontier words and continue with the next frontier
+ *             - Copy the distances, which are kept with one row per node, to 
+ *               the rows of the starting nodes
+ *
+ * Note      - Each node is scanned once per level for all the starting nodes
+ *             of the batch, rather than once per starting node
+ * 
+ */
+std::vector<std::vector<int> > KnightGraph::msBfsDistances(
+    std::vector<Vertex> starts)
+{
+    std::vector<std::vector<int> > distances(starts.size(), 
+        std::vector<int>(m_node_count, std::numeric_limits<int>::max()));
+
+    std::vector<uint64_t> seen(m_node_count, 0);
+    std::vector<uint64_t> frontier(m_node_count, 0);
+    std::vector<uint64_t> next_frontier(m_node_count, 0);
+    std::vector<int>      frontier_nodes;
+    std::vector<int>      next_frontier_nodes;
+
+    // Distances of the batch with one row per node, so the distances recorded
+    // for a node are next to each other
+    std::vector<int> node_distances;
+
+    for (unsigned int batch = 0; batch < starts.size(); batch += 64)
+    {
+        unsigned int batch_end = std::min<unsigned int>(batch + 64, 
+            starts.size());
+        // Sizes and indices of the batch rows are kept in size_t, since
+        // m_node_count * 64 does not fit in an int on the largest boards
+        size_t       lanes     = batch_end - batch;
+
+        std::fill(seen.begin(), seen.end(), 0);
+        node_distances.assign(static_cast<size_t>(m_node_count) * lanes, 
+            std::numeric_limits<int>::max());
+        frontier_nodes.clear();
+
+        // Place the valid starting nodes of the batch in the frontier
+        for (unsigned int s = batch; s < batch_end; s++)
+        {
+            Vertex start(starts[s].x, starts[s].y, m_board_row_size);
+            if (!startAndEndAreValid(start, start))
+            {
+                std::cout << "Start node is invalid.\n";
+                continue;
+            }
+
+            uint64_t bit = static_cast<uint64_t>(1) << (s - batch);
+            if (frontier[start.number] == 0)
+            {
+                frontier_nodes.push_back(start.number);
+            }
+            seen[start.number]     |= bit;
+            frontier[start.number] |= bit;
+            node_distances[(static_cast<size_t>(start.number) * lanes) + 
+                (s - batch)] = 0;
+        }
+
+        // Expand the frontier one level at a time for all starting nodes
+        int level = 0;
+        while (!frontier_nodes.empty())
+        {
+            next_frontier_nodes.clear();
+
+            for (unsigned int f = 0; f < frontier_nodes.size(); f++)
+            {
+                int      current = frontier_nodes[f];
+                uint64_t bits    = frontier[current];
+                uint8_t  mask    = m_validator->getLegalMoveMask(current);
+
+                for (int d = 0; d < KNIGHT_MOVE_COUNT; d++)
+                {
+                    if (!(mask & (1 << d)))
+                    {
+                        continue;
+                    }
+
+                    int      i        = getLandingNode(current, d);
+                    uint64_t new_bits = bits & ~seen[i];
+                    if (new_bits == 0)
+                    {
+                        continue;
+                    }
+
+                    if (next_frontier[i] == 0)
+                    {
+                        next_frontier_nodes.push_back(i);
+                    }
+                    next_frontier[i] |= new_bits;
+                    seen[i]          |= new_bits;
+
+                    // Record the distance for each starting node that reached
+                    // the landing node, in the row of the landing node
+                    while (new_bits != 0)
+                    {
+                        int s = __builtin_ctzll(new_bits);
+                        node_distances[(static_cast<size_t>(i) * lanes) + s] = 
+                            level + 1;
+                        new_bits &= new_bits - 1;
+                    }
+                }
+
+                frontier[current] = 0;
+            }
+
+            frontier_nodes.swap(next_frontier_nodes);
+            frontier.swap(next_frontier);
+            level++;
+        }
+
+        // Copy the distances from the rows of the nodes to the rows of the 
+        // starting nodes, a block of nodes at a time to stay in the cache
+        for (int block = 0; block < m_node_count; block += 64)
+        {
+            int block_end = std::min(block + 64, m_node_count);
+            for (unsigned int s = batch; s < batch_end; s++)
+            {
+                int *row = &distances[s][0];
+                for (int i = block; i < block_end; i++)
+                {
+                    row[i] = node_distances[(static_cast<size_t>(i) * lanes) + 
+                        (s - batch)];
+                }
+            }
+        }
+    }
+
+    return distances;
+}
+
+/* Algorithm - Call dfsGraphBuild() to build the adjacency list
  *           - Confirm the start and end points are on the board
- *           - Use Dijkstra's algo to retrieve a shortest path to the end node
- *             - Set the start Vertex distance to 0
- *             - Copy m_nodes to m_nodes_queue and set up a min heap
- *             - While the node queue contains nodes, extract the node with the
- *               min distance; mark the node visited; relax the edges of the 
+ *           - Reset m_nodes values to defaults and clear m_path
+ *           - If the graph file has a distance table for the start node and 
+ *             the parent chain of the end node in the table ends, copy the 
+ *             table values of the nodes on the path into m_nodes
+ *           - Otherwise call daSearch() to use Dijkstra's algo to find the 
+ *             shortest path to every node
+ *             - Set the start Vertex distance to 0 and place it in the indexed
+ *               min heap
+ *             - While the heap contains nodes, extract the node with the min 
+ *               distance; mark the node visited; relax the edges of the 
  *               connected nodes by making their distance the current node's 
- *               distance + the value from the adj matrix, then changing the 
- *               parent to the current vertex, as long as the current node 
- *               distance + the adj matrix value is less than the node's 
- *               distance
- *             - Once the min-priority queue is empty build the path in reverse 
- *               order from the destination to the source
+ *               distance + the edge weight from the adj list, then changing 
+ *               the parent to the current vertex, as long as the current node 
+ *               distance + the edge weight is less than the node's distance;
+ *               a relaxed node is added to the heap or has its key decreased
+ *           - Build the path in reverse order from the destination to the 
+ *             source
  *
- * Note      - The STL make_heap places the largest element at the top by 
- *             default, using comparison function that returns the smaller of 
- *             two types. A comparison returning the larger type will result in 
- *             a min heap.
- *           - m_node_queue will be the min-priority queue and m_nodes will be 
+ * Note      - m_node_heap is a 4-ary heap that stores the heap position of 
+ *             each node, so relaxing an edge costs O(log V); Nodes of equal 
+ *             distance are extracted in order of node number, as greater_dist
+ *             orders them
+ *           - m_node_heap will be the min-priority queue and m_nodes will be 
  *             the set of visited nodes
  *           - When building the path, if a teleport node is encountered, the 
  *             parent of the teleport node must be the other teleport node, so 
@@ -192,588 +529,2748 @@ void KnightGraph::bfsShortestPath(int start_x, int start_y,
  */
 void KnightGraph::daShortestPath(int start_x, int start_y, int end_x, int end_y)
 {
-    // Build the adjacency matrix
+    // Build the adjacency list
     dfsGraphBuild(start_x, start_y);
 
     // Verify start and end Vertex structs are on board and legal
     Vertex start(start_x, start_y, m_board_row_size);
     Vertex end(end_x, end_y, m_board_row_size);
 
-    bool start_is_on_board = m_validator->isOnBoard(start);
-    bool end_is_on_board   = m_validator->isOnBoard(end);
-    bool start_is_rock     = m_validator->isRock(start);
-    bool end_is_rock       = m_validator->isRock(end);
-    bool start_is_barrier  = m_validator->isBarrier(start);
-    bool end_is_barrier    = m_validator->isBarrier(end);
-
-    if (!start_is_on_board || !end_is_on_board || start_is_rock || end_is_rock 
-        || start_is_barrier || end_is_barrier)
+    if (!startAndEndAreValid(start, end))
     {
         std::cout << "Start or end node is invalid.\n";
         return;
     }
 
-    // Set the distance for the start node to 0
-    auto result = std::find_if(
-        m_nodes.begin(), m_nodes.end(), match_num(start.number));
-    if (result != m_nodes.end())
+    // Reset visited, parent, and distance status for all nodes
+    setM_nodeValsToDefaults();
+    m_path.clear();
+
+    // Find the parent chain of the end node in the distance table of the 
+    // start node if the graph file has one; A chain that does not end within
+    // m_node_count nodes has a cycle, so the table is not used
+    int table = m_graph_file ? m_graph_file->findTable(start.number) : -1;
+    std::vector<int> numbers;
+    if (table != -1)
     {
-        result->distance = 0;
+        const int *parents = m_graph_file->getTableParents(table);
+
+        numbers.push_back(end.number);
+        while (parents[numbers.back()] != -1 
+            && static_cast<int>(numbers.size()) <= m_node_count)
+        {
+            numbers.push_back(parents[numbers.back()]);
+        }
+
+        if (parents[numbers.back()] != -1)
+        {
+            table = -1;
+        }
     }
-    
-    // Copy all nodes in m_nodes to queue and create a min heap
-    for (unsigned int i = 0; i < m_nodes.size(); i++)
+
+    if (table != -1)
+    {
+        const int *distances = m_graph_file->getTableDistances(table);
+        const int *parents   = m_graph_file->getTableParents(table);
+
+        // Copy the table values of the nodes the path is built from: the 
+        // parent chain of the end node and the other teleport node of each
+        // teleport node on the chain
+        for (unsigned int i = 0, count = numbers.size(); i < count; i++)
+        {
+            const Vertex &node = m_nodes[numbers[i]];
+            if (m_board.getCell(node.x, node.y) == 'T')
+            {
+                numbers.push_back(m_validator->getTeleportNode(node).number);
+            }
+        }
+
+        for (unsigned int i = 0; i < numbers.size(); i++)
+        {
+            Vertex &node    = getNode(numbers[i]);
+            node.distance   = distances[numbers[i]];
+            node.parent_num = parents[numbers[i]];
+            node.visited    = 
+                (node.distance != std::numeric_limits<int>::max());
+        }
+        m_expanded_count = 0;
+    }
+    else
     {
-        m_node_queue.push_back(m_nodes[i]);
+        daSearch(start.number);
     }
-    std::make_heap(m_node_queue.begin(), m_node_queue.end(), greater_dist());
+
+    // Build path in reverse order
+    buildPathInReverse(start, end);
+}
+
+/* Algorithm - Set the distance for the start node to 0 and place it in 
+ *             m_node_heap
+ *           - While the heap contains nodes, extract the node with the min 
+ *             distance, mark it visited and relax the edges of the connected
+ *             nodes; a relaxed node is added to the heap or has its key
+ *             decreased
+ *
+ */
+void KnightGraph::daSearch(int start_number)
+{
+    // Set the distance for the start node to 0 and place it in the heap
+    m_node_heap.reset(m_node_count);
+    getNode(start_number).distance = 0;
+    m_node_heap.pushOrDecrease(start_number, 0);
+    m_expanded_count = 0;
 
     // Use Dijkstra's algorithm to find the shortest path
-    while (!m_node_queue.empty())
+    while (!m_node_heap.empty())
     {
-        // Get a copy of the front node
-        Vertex current = m_node_queue.front();
+        // Pop the node with the min distance off the top of the heap
+        int current = m_node_heap.pop();
 
         // Mark current node visited
-        auto result = std::find_if(
-            m_nodes.begin(), m_nodes.end(), match_num(current.number));
-        if (result != m_nodes.end())
+        getNode(current).visited = true;
+        m_expanded_count++;
+
+        // Check the adjacency list for connected nodes and relax edges
+        for (int e = m_csr_offsets[current]; e < m_csr_offsets[current + 1]; e++)
         {
-            result->visited = true;
+            int i        = m_csr_targets[e];
+            int distance = getNode(current).distance + m_csr_weights[e];
+
+            // Update node if the current node distance + edge weight is less
+            // than the connected node's distance
+            if (!getNode(i).visited && distance < getNode(i).distance)
+            {
+                getNode(i).distance   = distance;
+                getNode(i).parent_num = current;
+                m_node_heap.pushOrDecrease(i, distance);
+            }
         }
+    }
+}
+
+/* Algorithm - Call dfsGraphBuild() to build the adjacency list
+ *           - Confirm the start and end points are on the board
+ *           - Reset m_nodes values to defaults and clear m_path
+ *           - Use Dial's algo to retrieve a shortest path to the end node
+ *             - Create a circular queue of buckets, one bucket for each 
+ *               distance from the current distance up to the current distance
+ *               + the max edge weight
+ *             - Set the start Vertex distance to 0 and place it in bucket 0
+ *             - For each distance while the buckets contain nodes, sort the
+ *               bucket for the distance by node number; for each node in the 
+ *               bucket that is not visited and still has that distance, mark 
+ *               the node visited and relax the edges of the connected nodes, 
+ *               placing each relaxed node in the bucket for its new distance
+ *             - Once the buckets are empty build the path in reverse order 
+ *               from the destination to the source
+ *
+ * Note      - A node is placed in a bucket each time its distance decreases;
+ *             Entries for nodes that were later given a smaller distance are 
+ *             skipped when their bucket is reached
+ *           - Settling the nodes of a bucket in node number order matches the
+ *             tie breaking of greater_dist used by daShortestPath(), so both
+ *             methods choose the same parents and build the same path
+ * 
+ */
+void KnightGraph::dialShortestPath(int start_x, int start_y, 
+    int end_x, int end_y)
+{
+    // Build the adjacency list
+    dfsGraphBuild(start_x, start_y);
+
+    // Verify start and end Vertex structs are on board and legal
+    Vertex start(start_x, start_y, m_board_row_size);
+    Vertex end(end_x, end_y, m_board_row_size);
+
+    if (!startAndEndAreValid(start, end))
+    {
+        std::cout << "Start or end node is invalid.\n";
+        return;
+    }
+
+    // Reset visited, parent, and distance status for all nodes
+    setM_nodeValsToDefaults();
+    m_path.clear();
 
-        // Check the adjacency matrix for connected nodes and relax edges
-        for (unsigned int i = 0; i < m_adj_matrix[current.number].size(); i++)
+    // Create one bucket for each distance up to the max edge weight ahead of
+    // the current distance
+    int max_weight = 1;
+    for (int e = 0; e < m_csr_edge_count; e++)
+    {
+        max_weight = std::max(max_weight, m_csr_weights[e]);
+    }
+    int bucket_count = max_weight + 1;
+    std::vector<std::vector<int> > buckets(bucket_count);
+
+    // Set the distance for the start node to 0 and place it in a bucket
+    getNode(start.number).distance = 0;
+    buckets[0].push_back(start.number);
+    int queued_count = 1;
+    m_expanded_count = 0;
+
+    // Use Dial's algorithm to find the shortest path
+    for (int distance = 0; queued_count > 0; distance++)
+    {
+        std::vector<int> &bucket = buckets[distance % bucket_count];
+
+        // Settle nodes of equal distance in order of node number
+        std::sort(bucket.begin(), bucket.end());
+
+        for (unsigned int i = 0; i < bucket.size(); i++)
         {
-            if (m_adj_matrix[current.number][i] > 0)
+            int current = bucket[i];
+
+            // Skip nodes that were settled or moved to a nearer bucket
+            if (getNode(current).visited 
+                || getNode(current).distance != distance)
             {
-                // Update node if the current node distance + adj matrix value
-                // is less than the connected node's distance
-                auto result = std::find_if(
-                    m_node_queue.begin(), m_node_queue.end(), match_num(i));
+                continue;
+            }
+
+            // Mark current node visited
+            getNode(current).visited = true;
+            m_expanded_count++;
+
+            // Check the adjacency list for connected nodes and relax edges
+            for (int e = m_csr_offsets[current]; 
+                e < m_csr_offsets[current + 1]; e++)
+            {
+                int next   = m_csr_targets[e];
+                int weight = m_csr_weights[e];
 
-                if (result != m_node_queue.end() 
-                    && (current.distance + m_adj_matrix[current.number][i])
-                        < result->distance)
+                if (!getNode(next).visited 
+                    && (distance + weight) < getNode(next).distance)
                 {
-                    // Update distance in m_node_queue
-                    result->distance = current.distance 
-                        + m_adj_matrix[current.number][i];
-
-                    // Update parent node in m_nodes
-                    auto m_node_result = std::find_if(
-                        m_nodes.begin(), m_nodes.end(), match_num(i));
-                    if (m_node_result != m_nodes.end())
-                    {
-                        m_node_result->parent_num = current.number;
-                    }
+                    getNode(next).distance   = distance + weight;
+                    getNode(next).parent_num = current;
+
+                    // Place node in the bucket for its new distance
+                    buckets[(distance + weight) % bucket_count].push_back(next);
+                    queued_count++;
                 }
             }
         }
 
-        // Make heap again since changing distance values may have affected heap
-        std::make_heap(m_node_queue.begin(), m_node_queue.end(), greater_dist());
-
-        // Pop the current node off the top of the heap
-        std::pop_heap(m_node_queue.begin(), m_node_queue.end(), greater_dist());
-        m_node_queue.pop_back();
+        // Empty the bucket so it can be reused for a later distance
+        queued_count -= bucket.size();
+        bucket.clear();
     }
 
     // Build path in reverse order
     buildPathInReverse(start, end);
 }
 
-/* Algorithm - Call dfsGraphBuild() to build the adjacency matrix
+/* Algorithm - Call dfsGraphBuild() to build the adjacency list
  *           - Confirm the start and end points are on the board
- *           - Call daShortestPath() and place the path in m_path_store
- *           - Loop through longest path algorithm searches times
- *             - While the end node has not been reached and there are unvisited
- *               nodes to explore
- *               - Build path using heuristic of choosing next node having least 
- *               degree
- *               - Tiebreak 1: Get sum of degrees of neighbor nodes of least
- *               degree neighbors and choose least
- *               - Tiebreak 2: If current node and the next node is on the 
- *               previous longest path, choose another node
- *               - Tiebreak 3: Choose a node at random
- *               - Set the next node parent_num as the current node
- *               - Set the current_node to next_node
- *             - Build path in reverse order from end node
- *             - Add path to m_path_store then clear m_path
- *             - Reset m_nodes values to defaults
- *             - Copy longest path from m_node_store to m_path
+ *           - Reset m_nodes values to defaults and clear m_path
+ *           - Use A* search to retrieve a shortest path to the end node
+ *             - Find the min edge weight of the adjacency list; The min 
+ *               weight is 0 if the list has no edges
+ *             - Set the start Vertex distance to 0 and place it in the indexed
+ *               min heap with its distance estimate as the key
+ *             - While the heap contains nodes, extract the node with the min 
+ *               distance + estimate; mark the node visited; stop if the node is
+ *               the end node; otherwise relax the edges of the connected nodes
+ *               as Dijkstra's algo does, using the new distance + the estimate 
+ *               of the connected node as its key in the heap
+ *             - Build the path in reverse order from the destination to the 
+ *               source
+ *
+ * Note      - The estimate never exceeds the remaining distance and does not 
+ *             decrease by more than the edge weight across an edge, so a node
+ *             has its shortest distance once it is settled
  * 
  */
-void KnightGraph::apprLongestPath(int start_x, int start_y, int end_x, int end_y, 
-        int searches)
+void KnightGraph::astarShortestPath(int start_x, int start_y, 
+    int end_x, int end_y)
 {
-    // Build the adjacency matrix
+    // Build the adjacency list
     dfsGraphBuild(start_x, start_y);
 
     // Verify start and end Vertex structs are on board and legal
     Vertex start(start_x, start_y, m_board_row_size);
     Vertex end(end_x, end_y, m_board_row_size);
 
-    bool start_is_on_board = m_validator->isOnBoard(start);
-    bool end_is_on_board   = m_validator->isOnBoard(end);
-    bool start_is_rock     = m_validator->isRock(start);
-    bool end_is_rock       = m_validator->isRock(end);
-    bool start_is_barrier  = m_validator->isBarrier(start);
-    bool end_is_barrier    = m_validator->isBarrier(end);
-
-    if (!start_is_on_board || !end_is_on_board || start_is_rock || end_is_rock 
-        || start_is_barrier || end_is_barrier)
+    if (!startAndEndAreValid(start, end))
     {
         std::cout << "Start or end node is invalid.\n";
         return;
     }
 
-    // Call daShortestPath() and place the path in m_path_store
-    daShortestPath(start_x, start_y, end_x, end_y);
-    m_path_store.push_back(m_path);
-    m_path.clear();
-
     // Reset visited, parent, and distance status for all nodes
     setM_nodeValsToDefaults();
+    m_path.clear();
 
-    // Loop through longest path algorithm searches times
-    for (unsigned int i = 0; i < searches; i++)
+    // Find the min edge weight to scale the estimates
+    int min_weight = std::numeric_limits<int>::max();
+    for (int e = 0; e < m_csr_edge_count; e++)
     {
-        // Build path using heuristic of choosing next node having least degree
-        Vertex current_node = start;
-        bool are_unvisited_nodes = true;
-        while (current_node.number != end.number && are_unvisited_nodes)
+        min_weight = std::min(min_weight, m_csr_weights[e]);
+    }
+
+    // Without edges only the start node is settled, so any estimate will do
+    if (m_csr_edge_count == 0)
+    {
+        min_weight = 0;
+    }
+
+    // Set the distance for the start node to 0 and place it in the heap
+    m_node_heap.reset(m_node_count);
+    getNode(start.number).distance = 0;
+    m_node_heap.pushOrDecrease(start.number, 
+        getDistanceEstimate(start.number, end.number, min_weight));
+    m_expanded_count = 0;
+
+    // Use A* search to find the shortest path
+    while (!m_node_heap.empty())
+    {
+        // Pop the node with the min distance + estimate off the heap
+        int current = m_node_heap.pop();
+
+        // Mark current node visited
+        getNode(current).visited = true;
+        m_expanded_count++;
+
+        // Stop once the end node is settled
+        if (current == end.number)
         {
-            // Mark current node visited
-            auto result = std::find_if(
-                m_nodes.begin(), m_nodes.end(), match_num(current_node.number));
-            if (result != m_nodes.end())
-            {
-                result->visited = true;
-            }
+            break;
+        }
 
-            // Choose move to unvisited node with least degree
-            std::vector<Vertex> next_move_set = 
-                getLeastDegreeNeighbors(current_node);
+        // Check the adjacency list for connected nodes and relax edges
+        for (int e = m_csr_offsets[current]; e < m_csr_offsets[current + 1]; e++)
+        {
+            int i        = m_csr_targets[e];
+            int distance = getNode(current).distance + m_csr_weights[e];
 
-            if (next_move_set.size() == 0)
+            if (!getNode(i).visited && distance < getNode(i).distance)
             {
-                // No unvisited nodes available for move from this position
-                are_unvisited_nodes = false;
+                getNode(i).distance   = distance;
+                getNode(i).parent_num = current;
+                m_node_heap.pushOrDecrease(i, distance 
+                    + getDistanceEstimate(i, end.number, min_weight));
             }
-            else
-            {
-                // Check if tiebreakers are needed
-                // Tiebreak 1 - Get sum of degrees of neighbor nodes of least 
-                //              degree neighbors and choose least
-                if (next_move_set.size() > 1)
-                {
-                    std::vector<int> degree_sums;
-                    int least_degree_sum = std::numeric_limits<int>::max();
-                    for (unsigned int j = 0; j < next_move_set.size(); j++)
-                    {
-                        int sum = 
-                            getSumOfDegreesOfNeighbors(next_move_set[j]);
+        }
+    }
 
-                        degree_sums.push_back(sum);
+    // Build path in reverse order
+    buildPathInReverse(start, end);
+}
 
-                        // Set least degree sum if necessary
-                        if (sum < least_degree_sum)
-                        {
-                            least_degree_sum = sum;
-                        }
+/* Algorithm - Call dfsGraphBuild() to build the adjacency list and build the
+ *             reverse adjacency list
+ *           - Confirm the start and end points are on the board
+ *           - Reset m_nodes values to defaults and clear m_path
+ *           - Use a bidirectional search to retrieve a shortest path
+ *             - Place the start node in the forward heap and the end node in 
+ *               the backward heap, each with distance 0
+ *             - While both heaps contain nodes and the sum of their min 
+ *               distances is less than the best path distance found, settle
+ *               the node with the smaller min distance and relax its edges in
+ *               the adjacency list for the forward search or the reverse 
+ *               adjacency list for the backward search; If a relaxed node has
+ *               a distance from the other search, update the best path 
+ *               distance and the meeting node
+ *             - Set the parent of each node on the backward path from the 
+ *               meeting node to the end node, then build the path in reverse 
+ *               order from the destination to the source
+ *
+ * Note      - Forward distances and parents are kept in m_nodes; Backward 
+ *             distances and the next node towards the end are kept in local
+ *             vectors
+ *           - Teleport edges connect to the other teleport node in both lists,
+ *             so buildPathInReverse() inserts the teleport node that was moved
+ *             to, as it does for the other searches
+ * 
+ */
+void KnightGraph::bidiShortestPath(int start_x, int start_y, 
+    int end_x, int end_y, bool use_weights)
+{
+    // Build the adjacency list and the reverse adjacency list
+    dfsGraphBuild(start_x, start_y);
+    buildReverseAdjacencyList();
+
+    // Verify start and end Vertex structs are on board and legal
+    Vertex start(start_x, start_y, m_board_row_size);
+    Vertex end(end_x, end_y, m_board_row_size);
+
+    if (!startAndEndAreValid(start, end))
+    {
+        std::cout << "Start or end node is invalid.\n";
+        return;
+    }
+
+    // Reset visited, parent, and distance status for all nodes
+    setM_nodeValsToDefaults();
+    m_path.clear();
+
+    std::vector<int>  rev_distance(m_node_count, 
+        std::numeric_limits<int>::max());
+    std::vector<int>  rev_next(m_node_count, -1);
+    std::vector<bool> rev_visited(m_node_count, false);
+
+    // Place the start node in the forward heap and the end node in the 
+    // backward heap
+    m_node_heap.reset(m_node_count);
+    m_rev_node_heap.reset(m_node_count);
+    getNode(start.number).distance = 0;
+    rev_distance[end.number]       = 0;
+    m_node_heap.pushOrDecrease(start.number, 0);
+    m_rev_node_heap.pushOrDecrease(end.number, 0);
+    m_expanded_count = 0;
+
+    int best_distance = std::numeric_limits<int>::max();
+    int meeting_node  = -1;
+    if (start.number == end.number)
+    {
+        best_distance = 0;
+        meeting_node  = start.number;
+    }
+
+    // Search from both ends until the searches can no longer improve the best
+    // path distance
+    while (!m_node_heap.empty() && !m_rev_node_heap.empty())
+    {
+        int forward_min  = m_node_heap.getKey(m_node_heap.top());
+        int backward_min = m_rev_node_heap.getKey(m_rev_node_heap.top());
+
+        if (best_distance != std::numeric_limits<int>::max() 
+            && forward_min + backward_min >= best_distance)
+        {
+            break;
+        }
+
+        m_expanded_count++;
+
+        if (forward_min <= backward_min)
+        {
+            // Settle the forward node and relax its outgoing edges
+            int current = m_node_heap.pop();
+            getNode(current).visited = true;
+
+            for (int e = m_csr_offsets[current]; 
+                e < m_csr_offsets[current + 1]; e++)
+            {
+                int i        = m_csr_targets[e];
+                int weight   = use_weights ? m_csr_weights[e] : 1;
+                int distance = getNode(current).distance + weight;
+
+                if (!getNode(i).visited && distance < getNode(i).distance)
+                {
+                    getNode(i).distance   = distance;
+                    getNode(i).parent_num = current;
+                    m_node_heap.pushOrDecrease(i, distance);
+                }
+
+                // Check if the searches meet at the connected node
+                if (rev_distance[i] != std::numeric_limits<int>::max()
+                    && distance + rev_distance[i] < best_distance)
+                {
+                    best_distance = distance + rev_distance[i];
+                    meeting_node  = i;
+                }
+            }
+        }
+        else
+        {
+            // Settle the backward node and relax its incoming edges
+            int current = m_rev_node_heap.pop();
+            rev_visited[current] = true;
+
+            for (int e = m_rev_adj_offsets[current]; 
+                e < m_rev_adj_offsets[current + 1]; e++)
+            {
+                int i        = m_rev_adj_sources[e];
+                int weight   = use_weights ? m_rev_adj_weights[e] : 1;
+                int distance = rev_distance[current] + weight;
+
+                if (!rev_visited[i] && distance < rev_distance[i])
+                {
+                    rev_distance[i] = distance;
+                    rev_next[i]     = current;
+                    m_rev_node_heap.pushOrDecrease(i, distance);
+                }
+
+                // Check if the searches meet at the connected node
+                if (getNode(i).distance != std::numeric_limits<int>::max()
+                    && distance + getNode(i).distance < best_distance)
+                {
+                    best_distance = distance + getNode(i).distance;
+                    meeting_node  = i;
+                }
+            }
+        }
+    }
+
+    // Join the backward path to the forward path at the meeting node
+    if (meeting_node != -1)
+    {
+        int node_number = meeting_node;
+        while (rev_next[node_number] != -1)
+        {
+            getNode(rev_next[node_number]).parent_num = node_number;
+            node_number = rev_next[node_number];
+        }
+    }
+
+    // Build path in reverse order
+    buildPathInReverse(start, end);
+}
+
+/* Algorithm - Confirm the start and end points are on the board
+ *           - Reset m_nodes values to defaults and clear m_path
+ *           - Use Dijkstra's algo to retrieve a shortest path to the end node
+ *             - Set the start Vertex distance to 0 and place it in the indexed
+ *               min heap
+ *             - While the heap contains nodes, extract the node with the min
+ *               distance and mark it visited; stop if it is the end node;
+ *               otherwise call getNodeEdges() to generate its edges and relax
+ *               them as daShortestPath() does
+ *           - Build the path in reverse order from the destination to the 
+ *             source
+ *
+ * Note      - No adjacency list is built; Only the settled nodes have their 
+ *             edges generated
+ * 
+ */
+void KnightGraph::lazyShortestPath(int start_x, int start_y, 
+    int end_x, int end_y)
+{
+    // Verify start and end Vertex structs are on board and legal
+    Vertex start(start_x, start_y, m_board_row_size);
+    Vertex end(end_x, end_y, m_board_row_size);
+
+    if (!startAndEndAreValid(start, end))
+    {
+        std::cout << "Start or end node is invalid.\n";
+        return;
+    }
+
+    // Reset visited, parent, and distance status for all nodes
+    setM_nodeValsToDefaults();
+    m_path.clear();
+
+    // Set the distance for the start node to 0 and place it in the heap
+    m_node_heap.reset(m_node_count);
+    getNode(start.number).distance = 0;
+    m_node_heap.pushOrDecrease(start.number, 0);
+    m_expanded_count = 0;
+
+    // Use Dijkstra's algorithm to find the shortest path
+    while (!m_node_heap.empty())
+    {
+        // Pop the node with the min distance off the top of the heap
+        int current = m_node_heap.pop();
+
+        // Mark current node visited
+        getNode(current).visited = true;
+        m_expanded_count++;
+
+        // Stop once the end node is settled
+        if (current == end.number)
+        {
+            break;
+        }
+
+        // Generate the edges of the current node and relax them
+        int targets[KNIGHT_MOVE_COUNT];
+        int weights[KNIGHT_MOVE_COUNT];
+        int edge_count = getNodeEdges(current, targets, weights);
+
+        for (int e = 0; e < edge_count; e++)
+        {
+            int i        = targets[e];
+            int distance = getNode(current).distance + weights[e];
+
+            if (!getNode(i).visited && distance < getNode(i).distance)
+            {
+                getNode(i).distance   = distance;
+                getNode(i).parent_num = current;
+                m_node_heap.pushOrDecrease(i, distance);
+            }
+        }
+    }
+
+    // Build path in reverse order
+    buildPathInReverse(start, end);
+}
+
+/* Algorithm - Call dfsGraphBuild() to build the adjacency list
+ *           - Call prepareLongestPath() to confirm the start and end points are
+ *             on the board and place the shortest path in m_best_path
+ *           - Create a search state with a copy of m_nodes, a seeded random
+ *             number engine, and m_best_path as its longest path
+ *           - Call runRolloutWorker() to run the searches, keeping the longest
+ *             path of the state
+ *           - Copy the longest path of the state to m_best_path and m_path
+ * 
+ */
+void KnightGraph::apprLongestPath(int start_x, int start_y, int end_x, int end_y, 
+        int searches)
+{
+    // Build the adjacency list
+    dfsGraphBuild(start_x, start_y);
+
+    // Verify start and end Vertex structs are on board and legal, and place 
+    // the shortest path in m_best_path
+    Vertex start(start_x, start_y, m_board_row_size);
+    Vertex end(end_x, end_y, m_board_row_size);
+
+    if (!prepareLongestPath(start, end))
+    {
+        return;
+    }
+
+    // Search state with its own copy of the nodes, a seeded random number 
+    // engine, and the shortest path as its longest path
+    RolloutState state;
+    initRolloutState(state);
+    setRolloutLongestPath(m_best_path, state);
+    std::random_device rd;
+    state.engine.seed(rd());
+
+    // Loop through longest path algorithm searches times
+    runRolloutWorker(start, end, searches, state);
+
+    // Copy longest path to m_path
+    m_best_path = state.longest_path;
+    m_path      = m_best_path;
+}
+
+/* Algorithm - Call prepareLongestPath() to confirm the start and end points are
+ *             on the board and place the shortest path in m_best_path
+ *           - Create a search state with a copy of m_nodes, a seeded random
+ *             number engine, and m_best_path as its longest path
+ *           - Call the progress callback with the length of the shortest path
+ *           - Until the deadline passes or m_bound_reached is set
+ *             - Call runRollout() to build a path, avoiding the longest path of
+ *               the state
+ *             - If the path reaches the end node and is longer than the longest
+ *               path, make it the longest path of the state and call the 
+ *               progress callback with its length; If it visits 
+ *               m_path_node_bound distinct nodes, set m_bound_reached
+ *           - Copy the longest path of the state to m_best_path and m_path
+ *
+ * Note      - The deadline is checked between searches, so the method returns
+ *             at most one search after the deadline
+ * 
+ */
+void KnightGraph::apprLongestPath(int start_x, int start_y, int end_x, int end_y, 
+    std::chrono::steady_clock::time_point deadline, 
+    std::function<void(int, double)> progress)
+{
+    // Verify start and end Vertex structs are on board and legal, and place 
+    // the shortest path in m_best_path
+    Vertex start(start_x, start_y, m_board_row_size);
+    Vertex end(end_x, end_y, m_board_row_size);
+
+    if (!prepareLongestPath(start, end))
+    {
+        return;
+    }
+
+    // Search state with its own copy of the nodes, a seeded random number 
+    // engine, and the shortest path as its longest path
+    RolloutState state;
+    initRolloutState(state);
+    setRolloutLongestPath(m_best_path, state);
+    std::random_device rd;
+    state.engine.seed(rd());
+
+    // Report the shortest path as the first longest path
+    int total_possible_moves = calcTotalPossibleMoves();
+    if (progress)
+    {
+        int length = calcPathLength(state.longest_path);
+        progress(length, static_cast<double>(length) 
+            / static_cast<double>(total_possible_moves));
+    }
+
+    // Loop through longest path algorithm searches until the deadline
+    while (std::chrono::steady_clock::now() < deadline && !m_bound_reached)
+    {
+        // Build path using heuristic of choosing next node having least degree
+        runRollout(start, end, state);
+
+        // Report a new longest path
+        if (state.path.size() > state.longest_path.size() 
+            && state.path.back().number == end.number)
+        {
+            setRolloutLongestPath(state.path, state);
+            if (progress)
+            {
+                int length = calcPathLength(state.longest_path);
+                progress(length, static_cast<double>(length) 
+                    / static_cast<double>(total_possible_moves));
+            }
+
+            // No path can visit more nodes
+            if (reachesPathNodeBound(state.longest_path))
+            {
+                m_bound_reached = true;
+            }
+        }
+    }
+
+    // Copy longest path to m_path
+    m_best_path = state.longest_path;
+    m_path      = m_best_path;
+}
+
+/* Algorithm - Call prepareLongestPath() to confirm the start and end points are
+ *             on the board and place the shortest path in m_best_path
+ *           - Create a search state for each thread with a copy of m_nodes, a 
+ *             random number engine seeded from std::random_device, and 
+ *             m_best_path as its longest path
+ *           - Start a thread per search state to call runRolloutWorker() for 
+ *             its share of the searches, then wait for the threads to finish
+ *           - Copy the longest path of the search states to m_best_path and 
+ *             m_path
+ *
+ * Note      - The threads only read the shared members, other than the atomic 
+ *             m_bound_reached, so they need no locks;
+ *             Each thread avoids its own longest path, rather than the longest
+ *             path of all the searches so far
+ * 
+ */
+void KnightGraph::parApprLongestPath(int start_x, int start_y, int end_x, 
+    int end_y, int searches, int threads)
+{
+    // Verify start and end Vertex structs are on board and legal, and place 
+    // the shortest path in m_best_path
+    Vertex start(start_x, start_y, m_board_row_size);
+    Vertex end(end_x, end_y, m_board_row_size);
+
+    if (!prepareLongestPath(start, end))
+    {
+        return;
+    }
+
+    // Use no more threads than searches
+    if (threads <= 0)
+    {
+        threads = std::thread::hardware_concurrency();
+    }
+    if (threads > searches)
+    {
+        threads = searches;
+    }
+    if (threads < 1)
+    {
+        threads = 1;
+    }
+
+    // Create a search state for each thread
+    std::vector<RolloutState> states(threads);
+    std::random_device rd;
+    for (int t = 0; t < threads; t++)
+    {
+        initRolloutState(states[t]);
+        setRolloutLongestPath(m_best_path, states[t]);
+        states[t].engine.seed(rd());
+    }
+
+    // Divide the searches between the threads
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; t++)
+    {
+        int thread_searches = (searches / threads) 
+            + ((t < (searches % threads)) ? 1 : 0);
+        workers.push_back(std::thread(&KnightGraph::runRolloutWorker, this, 
+            start, end, thread_searches, std::ref(states[t])));
+    }
+
+    for (unsigned int t = 0; t < workers.size(); t++)
+    {
+        workers[t].join();
+    }
+
+    // Keep the longest path of the threads
+    for (int t = 0; t < threads; t++)
+    {
+        if (states[t].longest_path.size() > m_best_path.size())
+        {
+            m_best_path = states[t].longest_path;
+        }
+    }
+
+    // Copy longest path to m_path
+    m_path = m_best_path;
+}
+
+/* Algorithm - Confirm the start and end points are on the board
+ *           - Call dfsGraphBuild() to build the adjacency list and build the 
+ *             reverse adjacency list
+ *           - If m_path_used has at most EXACT_MEMO_WORDS words, size 
+ *             m_exact_memo to keep the states searched to the end
+ *           - Call getStartBound() to start the path at the start node and 
+ *             bound it; If the end node is not reachable, there is no path
+ *           - Push the search frame of the start node on the stack
+ *           - While the stack is not empty
+ *             - If the top frame has no moves left, call keepExactState() to
+ *               keep its state as searched, remove its node from the path and
+ *               pop it
+ *             - Take the next move of the top frame
+ *             - If the move reaches the end node, keep the path if it is 
+ *               longer than the longest path; Stop if it reaches the bound of 
+ *               the start node, since no path can be longer
+ *             - Otherwise, stop if the node budget is spent and mark the node
+ *               used; If isExactStateSearched() finds the state was searched 
+ *               with at least the same length, or the bound of the path from
+ *               it cannot make a longer path, unmark the node, otherwise push 
+ *               its search frame
+ *           - Set the parent nodes along the longest path and build m_path
+ *           - Free m_exact_memo
+ *
+ * Note      - The end node is only entered as the last node of a path
+ *           - A state is the set of nodes on the path and the node at its end;
+ *             Once it has been searched to the end, the longest path is at 
+ *             least as long as any path through it, so reaching it again with
+ *             no greater length cannot find a longer path
+ * 
+ */
+bool KnightGraph::exactLongestPath(int start_x, int start_y, int end_x, 
+    int end_y, long long node_budget)
+{
+    m_path.clear();
+    m_expanded_count = 0;
+
+    // Verify start and end Vertex structs are on board and legal
+    Vertex start(start_x, start_y, m_board_row_size);
+    Vertex end(end_x, end_y, m_board_row_size);
+
+    if (!startAndEndAreValid(start, end))
+    {
+        std::cout << "Start or end node is invalid.\n";
+        return false;
+    }
+
+    // Build the adjacency list and the reverse adjacency list, which 
+    // removeDeadEndNodes() reads
+    dfsGraphBuild(start_x, start_y);
+    buildReverseAdjacencyList();
+
+    // Keep the states searched to the end on small boards
+    m_exact_memo.clear();
+    if (m_bitboard->getWordCount() <= EXACT_MEMO_WORDS)
+    {
+        ExactMemoEntry empty = ExactMemoEntry();
+        empty.number = -1;
+        m_exact_memo.assign(EXACT_MEMO_SIZE, empty);
+    }
+
+    std::vector<int> longest_path;
+    int              longest_distance = -1;
+    bool             budget_was_spent = false;
+
+    // Stack of search frames; A frame is never pushed for the end node, so the
+    // stack holds at most one frame per node
+    std::vector<ExactFrame> stack(m_node_count);
+    int                     stack_size = 0;
+
+    // Start the path at the start node and bound it
+    int start_bound = getStartBound(start, end, true);
+
+    if (start.number == end.number)
+    {
+        longest_path.push_back(start.number);
+        longest_distance = 0;
+    }
+    else if (start_bound != -1)
+    {
+        initExactFrame(start.number, 0, stack[stack_size]);
+        stack_size++;
+    }
+
+    while (stack_size > 0)
+    {
+        ExactFrame &frame = stack[stack_size - 1];
+
+        // Backtrack once every move of the frame has been tried
+        if (frame.next_edge == frame.edge_count)
+        {
+            keepExactState(frame.number, frame.distance);
+            markExactNode(frame.number, false);
+            stack_size--;
+            continue;
+        }
+
+        int next_node     = frame.targets[frame.next_edge];
+        int next_distance = frame.distance + frame.weights[frame.next_edge];
+        frame.next_edge++;
+
+        // Keep a path that reaches the end node if it is the longest path
+        if (next_node == end.number)
+        {
+            if (next_distance > longest_distance)
+            {
+                longest_distance = next_distance;
+                longest_path.clear();
+                for (int i = 0; i < stack_size; i++)
+                {
+                    longest_path.push_back(stack[i].number);
+                }
+                longest_path.push_back(end.number);
+
+                // No path can be longer than the bound of the start node
+                if (longest_distance == start_bound)
+                {
+                    break;
+                }
+            }
+            continue;
+        }
+
+        if (m_expanded_count >= node_budget)
+        {
+            budget_was_spent = true;
+            break;
+        }
+        m_expanded_count++;
+
+        // Cut the branch if it was searched before or cannot lead to a 
+        // longer path
+        markExactNode(next_node, true);
+        if (isExactStateSearched(next_node, next_distance))
+        {
+            markExactNode(next_node, false);
+            continue;
+        }
+
+        int bound = getReachableWeightBound(next_node, end.number, true);
+        if (bound == -1 || next_distance + bound <= longest_distance)
+        {
+            markExactNode(next_node, false);
+            continue;
+        }
+
+        initExactFrame(next_node, next_distance, stack[stack_size]);
+        stack_size++;
+    }
+
+    // Set the parent nodes along the longest path and build the path
+    if (!longest_path.empty())
+    {
+        setM_nodeValsToDefaults();
+        for (unsigned int i = 1; i < longest_path.size(); i++)
+        {
+            getNode(longest_path[i]).parent_num = longest_path[i - 1];
+        }
+        buildPathInReverse(start, end);
+    }
+
+    // Free the searched states
+    std::vector<ExactMemoEntry>().swap(m_exact_memo);
+
+    return !budget_was_spent;
+}
+
+/* Algorithm - Generate the edges of the node with getNodeEdges() and keep the 
+ *             ones to nodes not in m_path_used
+ *           - Count the onward moves of each target to nodes not in 
+ *             m_path_used
+ *           - Insertion sort the moves by their onward move counts, so ties 
+ *             keep the direction order
+ * 
+ */
+void KnightGraph::initExactFrame(int number, int distance, ExactFrame &frame)
+{
+    frame.number     = number;
+    frame.distance   = distance;
+    frame.edge_count = 0;
+    frame.next_edge  = 0;
+
+    int targets[KNIGHT_MOVE_COUNT];
+    int weights[KNIGHT_MOVE_COUNT];
+    int edge_count = getNodeEdges(number, targets, weights);
+
+    int onward_counts[KNIGHT_MOVE_COUNT];
+    for (int e = 0; e < edge_count; e++)
+    {
+        if (BitBoard::testBit(m_path_used, targets[e]))
+        {
+            continue;
+        }
+
+        // Count the onward moves of the target
+        int onward_targets[KNIGHT_MOVE_COUNT];
+        int onward_weights[KNIGHT_MOVE_COUNT];
+        int onward_edge_count = 
+            getNodeEdges(targets[e], onward_targets, onward_weights);
+        int onward_count = 0;
+        for (int o = 0; o < onward_edge_count; o++)
+        {
+            if (!BitBoard::testBit(m_path_used, onward_targets[o]))
+            {
+                onward_count++;
+            }
+        }
+
+        // Insert the move after the moves with no more onward moves
+        int k = frame.edge_count;
+        while (k > 0 && onward_counts[k - 1] > onward_count)
+        {
+            frame.targets[k] = frame.targets[k - 1];
+            frame.weights[k] = frame.weights[k - 1];
+            onward_counts[k] = onward_counts[k - 1];
+            k--;
+        }
+        frame.targets[k] = targets[e];
+        frame.weights[k] = weights[e];
+        onward_counts[k] = onward_count;
+        frame.edge_count++;
+    }
+}
+
+/* Algorithm - Set or clear the bit of the node in m_path_used
+ *           - If the node is a teleport node, set or clear the bit of both 
+ *             teleport nodes
+ * 
+ */
+void KnightGraph::markExactNode(int number, bool used)
+{
+    int numbers[2] = { number, -1 };
+    if (number == m_teleport_one || number == m_teleport_two)
+    {
+        numbers[0] = m_teleport_one;
+        numbers[1] = m_teleport_two;
+    }
+
+    for (int i = 0; i < 2 && numbers[i] != -1; i++)
+    {
+        if (used)
+        {
+            BitBoard::setBit(m_path_used, numbers[i]);
+        }
+        else
+        {
+            BitBoard::clearBit(m_path_used, numbers[i]);
+        }
+    }
+}
+
+/* Algorithm - If m_exact_memo is empty, return false
+ *           - Return true if the entry of the state holds the state with at 
+ *             least the length
+ * 
+ */
+bool KnightGraph::isExactStateSearched(int number, int distance)
+{
+    if (m_exact_memo.empty())
+    {
+        return false;
+    }
+
+    const ExactMemoEntry &entry = getExactMemoEntry(number);
+    if (entry.number != number || entry.distance < distance)
+    {
+        return false;
+    }
+
+    for (int i = 0; i < EXACT_MEMO_WORDS; i++)
+    {
+        uint64_t word = (i < static_cast<int>(m_path_used.size())) 
+            ? m_path_used[i] : 0;
+        if (entry.used[i] != word)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/* Algorithm - If m_exact_memo is empty, return
+ *           - If the entry of the state holds the state, keep the greater 
+ *             length; Otherwise replace the entry with the state
+ * 
+ */
+void KnightGraph::keepExactState(int number, int distance)
+{
+    if (m_exact_memo.empty())
+    {
+        return;
+    }
+
+    ExactMemoEntry &entry = getExactMemoEntry(number);
+
+    bool same_state = (entry.number == number);
+    for (int i = 0; i < EXACT_MEMO_WORDS; i++)
+    {
+        uint64_t word = (i < static_cast<int>(m_path_used.size())) 
+            ? m_path_used[i] : 0;
+        same_state    = same_state && (entry.used[i] == word);
+        entry.used[i] = word;
+    }
+
+    if (!same_state || entry.distance < distance)
+    {
+        entry.distance = distance;
+    }
+    entry.number = number;
+}
+
+/* Algorithm - Hash the node number and the words of m_path_used with a 
+ *             multiply and xor-shift per word
+ *           - Return the entry at the top bits of the hash
+ * 
+ */
+KnightGraph::ExactMemoEntry &KnightGraph::getExactMemoEntry(int number)
+{
+    const uint64_t MULTIPLIER = 0x9E3779B97F4A7C15ULL;
+
+    uint64_t hash = (static_cast<uint64_t>(number) + 1) * MULTIPLIER;
+    for (unsigned int i = 0; i < m_path_used.size(); i++)
+    {
+        hash  = (hash ^ m_path_used[i]) * MULTIPLIER;
+        hash ^= hash >> 29;
+    }
+
+    return m_exact_memo[(hash >> 32) % EXACT_MEMO_SIZE];
+}
+
+/* Algorithm - Reset m_path_used and the bound planes
+ *           - Mark the start node used
+ *           - Return the bound of getReachableWeightBound() for the start node
+ * 
+ */
+int KnightGraph::getStartBound(Vertex start, Vertex end, bool weighted)
+{
+    int word_count = m_bitboard->getWordCount();
+    m_path_used.assign(word_count, 0);
+    m_bound_free.assign(word_count, 0);
+    m_bound_frontier.assign(word_count, 0);
+    m_bound_reachable.assign(word_count, 0);
+    m_bound_seen.assign(word_count, 0);
+
+    markExactNode(start.number, true);
+
+    return getReachableWeightBound(start.number, end.number, weighted);
+}
+
+/* Algorithm - The free plane is the passable plane without the nodes in 
+ *             m_path_used
+ *           - Flood the free plane from the node with expandFrontier() and 
+ *             mergeFrontier() until no new node is found
+ *           - If the end node was not reached, return -1
+ *           - If the bound is weighted, call removeDeadEndNodes() to leave out
+ *             the reached nodes a simple path cannot pass through
+ *           - Count the reached nodes of each weight on the color of the node 
+ *             and on the other color: 1 for '.' and 'T' nodes, 
+ *             WATER_NODE_WEIGHT for 'W' nodes and LAVA_NODE_WEIGHT for 'L' 
+ *             nodes, or 1 for every node if the bound is not weighted; The 
+ *             weighted bound leaves out the nodes of a teleport pair
+ *           - The reachable bound is the sum of the weights of all reached 
+ *             nodes, plus 1 for a teleport node if the weighted bound left out
+ *             a reached one
+ *           - Without a teleport pair, call getColorBound() to bound the path
+ *             by the colors of the nodes it lands on, and return the lesser of
+ *             the color bound and the reachable bound
+ *           - With a teleport pair, return the reachable bound if the bound is
+ *             not weighted
+ *           - Otherwise the path lands on a teleport node only with its move 
+ *             through the pair, and every other move changes color; Call 
+ *             getColorBound() for the path without the move, and for the path
+ *             with the move onto each reached teleport node; If the pair has 
+ *             two colors the move keeps the color, so the teleport node is an
+ *             extra node of its color, otherwise it is one more node of its 
+ *             color the alternating path can land on
+ *           - Return the lesser of the greatest color bound and the reachable
+ *             bound
+ *
+ * Note      - Unweighted, both teleport nodes count 1, since a rollout path 
+ *             visits the node it lands on and the node it moves to
+ * 
+ */
+int KnightGraph::getReachableWeightBound(int number, int end_number, 
+    bool weighted)
+{
+    const std::vector<uint64_t> &passable = m_bitboard->getPassablePlane();
+    int word_count = m_bitboard->getWordCount();
+
+    for (int i = 0; i < word_count; i++)
+    {
+        m_bound_free[i]     = passable[i] & ~m_path_used[i];
+        m_bound_frontier[i] = 0;
+        m_bound_seen[i]     = 0;
+    }
+    BitBoard::setBit(m_bound_frontier, number);
+
+    // Flood the free nodes from the node
+    while (true)
+    {
+        m_bitboard->expandFrontier(m_bound_frontier, m_bound_reachable);
+        if (!BitBoard::mergeFrontier(m_bound_reachable, m_bound_free, 
+            m_bound_seen))
+        {
+            break;
+        }
+        m_bound_frontier.swap(m_bound_reachable);
+    }
+
+    if (!BitBoard::testBit(m_bound_seen, end_number))
+    {
+        return -1;
+    }
+
+    // A simple path cannot pass through a dead end
+    if (weighted)
+    {
+        removeDeadEndNodes(number, end_number);
+    }
+
+    // Count the reached nodes of each weight on each color; Color 0 is the
+    // color of the node and color 1 is the other color
+    const std::vector<uint64_t> &free_plane = 
+        m_bitboard->getPlane(BitBoard::FREE_PLANE);
+    const std::vector<uint64_t> &water_plane = 
+        m_bitboard->getPlane(BitBoard::WATER_PLANE);
+    const std::vector<uint64_t> &lava_plane = 
+        m_bitboard->getPlane(BitBoard::LAVA_PLANE);
+    const std::vector<uint64_t> &teleport_plane = 
+        m_bitboard->getPlane(BitBoard::TELEPORT_PLANE);
+    const std::vector<uint64_t> &light_plane = m_bitboard->getLightPlane();
+
+    bool node_is_light = BitBoard::testBit(light_plane, number);
+
+    // Weights from the lightest to the heaviest
+    int weights[3] = { 1, WATER_NODE_WEIGHT, LAVA_NODE_WEIGHT };
+    if (!weighted)
+    {
+        weights[1] = 1;
+        weights[2] = 1;
+    }
+
+    // The weighted bound leaves out the teleport pair; A simple path lands on
+    // a teleport node only by moving through the pair, once
+    bool count_teleports = (!weighted || m_teleport_one == -1);
+
+    int counts[2][3] = { { 0, 0, 0 }, { 0, 0, 0 } };
+    for (int i = 0; i < word_count; i++)
+    {
+        uint64_t same_color = node_is_light ? light_plane[i] : ~light_plane[i];
+        uint64_t teleports  = count_teleports ? teleport_plane[i] : 0;
+        for (int c = 0; c < 2; c++)
+        {
+            uint64_t seen = m_bound_seen[i] & ((c == 0) ? same_color 
+                : ~same_color);
+            counts[c][0] += 
+                __builtin_popcountll(seen & (free_plane[i] | teleports));
+            counts[c][1] += __builtin_popcountll(seen & water_plane[i]);
+            counts[c][2] += __builtin_popcountll(seen & lava_plane[i]);
+        }
+    }
+
+    // Sum the weights of the reached nodes
+    int bound = 0;
+    for (int c = 0; c < 2; c++)
+    {
+        for (int w = 0; w < 3; w++)
+        {
+            bound += counts[c][w] * weights[w];
+        }
+    }
+
+    bool same_color = 
+        (BitBoard::testBit(light_plane, end_number) == node_is_light);
+
+    // Without a teleport pair, the path alternates colors
+    if (m_teleport_one == -1)
+    {
+        return std::min(bound, getColorBound(counts, weights, same_color, -1));
+    }
+
+    // A rollout can move through the teleport pair more than once
+    if (!weighted)
+    {
+        return bound;
+    }
+
+    // Bound the path without the teleport pair, then with a move through it
+    // onto each reached teleport node
+    int  color_bound = getColorBound(counts, weights, same_color, -1);
+    bool keeps_color = (BitBoard::testBit(light_plane, m_teleport_one) 
+        != BitBoard::testBit(light_plane, m_teleport_two));
+    bool teleport_was_reached = false;
+    int  teleport_nodes[2] = { m_teleport_one, m_teleport_two };
+
+    for (int t = 0; t < 2; t++)
+    {
+        if (!BitBoard::testBit(m_bound_seen, teleport_nodes[t]))
+        {
+            continue;
+        }
+        teleport_was_reached = true;
+
+        int c = (BitBoard::testBit(light_plane, teleport_nodes[t]) 
+            == node_is_light) ? 0 : 1;
+        if (keeps_color)
+        {
+            color_bound = std::max(color_bound, 
+                getColorBound(counts, weights, same_color, c));
+        }
+        else
+        {
+            counts[c][0]++;
+            color_bound = std::max(color_bound, 
+                getColorBound(counts, weights, same_color, -1));
+            counts[c][0]--;
+        }
+    }
+
+    if (teleport_was_reached)
+    {
+        bound += weights[0];
+    }
+
+    return std::min(bound, color_bound);
+}
+
+/* Algorithm - A path to an end node of the other color lands on one more node 
+ *             of the other color than of the same color, and a path to an end 
+ *             node of the same color lands on as many of each
+ *           - Sum the heaviest weights of the nodes of each color the path can
+ *             land on
+ *           - Add the weight of the extra node, which is not in the counts
+ * 
+ */
+int KnightGraph::getColorBound(const int counts[2][3], const int weights[3], 
+    bool same_color, int extra)
+{
+    int totals[2] = { counts[0][0] + counts[0][1] + counts[0][2], 
+        counts[1][0] + counts[1][1] + counts[1][2] };
+
+    int landings[2];
+    if (same_color)
+    {
+        landings[0] = std::min(totals[0], totals[1]);
+        landings[1] = landings[0];
+    }
+    else
+    {
+        landings[0] = std::min(totals[0], totals[1] - 1);
+        landings[1] = landings[0] + 1;
+    }
+
+    if (landings[0] < 0)
+    {
+        return 0;
+    }
+
+    // Sum the heaviest weights of the nodes the path can land on
+    int color_bound = 0;
+    for (int c = 0; c < 2; c++)
+    {
+        int remaining = landings[c];
+        for (int w = 2; w >= 0 && remaining > 0; w--)
+        {
+            int taken = std::min(counts[c][w], remaining);
+            color_bound += taken * weights[w];
+            remaining   -= taken;
+        }
+    }
+
+    if (extra != -1)
+    {
+        color_bound += weights[0];
+    }
+
+    return color_bound;
+}
+
+/* Algorithm - Until no node is removed, loop through the nodes of 
+ *             m_bound_seen other than the end node
+ *             - Count the moves onto the node in the reverse adjacency list 
+ *               from the node the path is on or a node of m_bound_seen, and 
+ *               the moves off it in the adjacency list to a node of 
+ *               m_bound_seen, up to two of each
+ *             - Remove the node if it has no move onto it, no move off it, or
+ *               only a move onto it and a move off it with the same node
+ *
+ * Note      - A simple path can only end at such a node, and it ends at the 
+ *             end node, so it never lands on one
+ * 
+ */
+void KnightGraph::removeDeadEndNodes(int number, int end_number)
+{
+    int  word_count = m_bitboard->getWordCount();
+    bool removed    = true;
+
+    while (removed)
+    {
+        removed = false;
+        for (int w = 0; w < word_count; w++)
+        {
+            uint64_t bits = m_bound_seen[w];
+            while (bits != 0)
+            {
+                int node = (w * 64) + __builtin_ctzll(bits);
+                bits &= bits - 1;
+
+                if (node == end_number)
+                {
+                    continue;
+                }
+
+                // Count the moves onto the node
+                int in_count = 0;
+                int source   = -1;
+                for (int e = m_rev_adj_offsets[node]; 
+                    e < m_rev_adj_offsets[node + 1] && in_count < 2; e++)
+                {
+                    int n = m_rev_adj_sources[e];
+                    if (n == number || BitBoard::testBit(m_bound_seen, n))
+                    {
+                        in_count++;
+                        source = n;
+                    }
+                }
+
+                // Count the moves off the node
+                int out_count = 0;
+                int target    = -1;
+                for (int e = m_csr_offsets[node]; 
+                    e < m_csr_offsets[node + 1] && out_count < 2; e++)
+                {
+                    int n = m_csr_targets[e];
+                    if (BitBoard::testBit(m_bound_seen, n))
+                    {
+                        out_count++;
+                        target = n;
                     }
+                }
+
+                if (in_count == 0 || out_count == 0 
+                    || (in_count == 1 && out_count == 1 && source == target))
+                {
+                    BitBoard::clearBit(m_bound_seen, node);
+                    removed = true;
+                }
+            }
+        }
+    }
+}
+
+/* Algorithm - Copy the node numbers of m_path, set their bits in a path 
+ *             membership plane and record the position of each node; Leave the
+ *             path as it is if it repeats a node
+ *           - Until the deadline passes
+ *             - Call insertPathDetours() to splice unvisited nodes into the 
+ *               path, then record the positions of the nodes that moved
+ *             - If no node was spliced, call reversePathSegment() to change 
+ *               which nodes are consecutive; Stop if no segment can be 
+ *               reversed
+ *           - Copy the path back to m_path and m_best_path
+ * 
+ */
+void KnightGraph::improveLongestPath(
+    std::chrono::steady_clock::time_point deadline)
+{
+    if (m_path.size() < 2)
+    {
+        return;
+    }
+
+    // Copy the path, mark its nodes and record their positions
+    std::vector<int>      path;
+    std::vector<uint64_t> on_path(m_bitboard->getWordCount(), 0);
+    std::vector<int>      positions(m_node_count, -1);
+    for (unsigned int i = 0; i < m_path.size(); i++)
+    {
+        int number = m_path[i].number;
+        if (BitBoard::testBit(on_path, number))
+        {
+            return;
+        }
+
+        path.push_back(number);
+        BitBoard::setBit(on_path, number);
+        positions[number] = i;
+    }
+
+    std::random_device rd;
+    std::mt19937       engine(rd());
+
+    // Lengthen the path until the deadline
+    while (std::chrono::steady_clock::now() < deadline)
+    {
+        if (insertPathDetours(path, on_path) > 0)
+        {
+            // The nodes after each detour moved along the path
+            for (unsigned int i = 0; i < path.size(); i++)
+            {
+                positions[path[i]] = i;
+            }
+        }
+        else if (!reversePathSegment(path, positions, engine))
+        {
+            break;
+        }
+    }
+
+    // Copy the path back to m_path
+    m_path.clear();
+    for (unsigned int i = 0; i < path.size(); i++)
+    {
+        m_path.push_back(m_nodes[path[i]]);
+        m_path.back().visited    = false;
+        m_path.back().parent_num = (i > 0) ? path[i - 1] : -1;
+    }
+    m_best_path = m_path;
+}
+
+/* Algorithm - Find the direction of the move from its x and y offsets
+ *           - Return whether the bit of the direction is set in the legal move
+ *             mask of the starting node
+ * 
+ */
+bool KnightGraph::isLegalMove(int from, int to)
+{
+    int x_offset = m_nodes[to].x - m_nodes[from].x;
+    int y_offset = m_nodes[to].y - m_nodes[from].y;
+
+    uint8_t mask = m_validator->getLegalMoveMask(from);
+    for (int d = 0; d < KNIGHT_MOVE_COUNT; d++)
+    {
+        if (KNIGHT_MOVE_X[d] == x_offset && KNIGHT_MOVE_Y[d] == y_offset)
+        {
+            return (mask & (1 << d)) != 0;
+        }
+    }
+
+    return false;
+}
+
+/* Algorithm - Return true if the node is one of the teleport pair
+ * 
+ */
+bool KnightGraph::isTeleportNode(int number)
+{
+    return number != -1 
+        && (number == m_teleport_one || number == m_teleport_two);
+}
+
+/* Algorithm - For each pair of consecutive path nodes a and b, neither of them
+ *             a teleport node
+ *             - For each legal move target u of a that is not on the path or a
+ *               teleport node
+ *               - For each legal move target v of u that is not on the path or 
+ *                 a teleport node, if v has a legal move to b, splice u and v 
+ *                 between a and b and mark them on the path
+ *
+ * Note      - A single node cannot be spliced, since a knight move always 
+ *             changes the color of the node, so a and b have different colors
+ *             and no node is a move away from both
+ * 
+ */
+int KnightGraph::insertPathDetours(std::vector<int> &path, 
+    std::vector<uint64_t> &on_path)
+{
+    int added = 0;
+    for (unsigned int i = 0; i + 1 < path.size(); i++)
+    {
+        int a = path[i];
+        int b = path[i + 1];
+        if (isTeleportNode(a) || isTeleportNode(b))
+        {
+            continue;
+        }
+
+        uint8_t a_mask  = m_validator->getLegalMoveMask(a);
+        bool    spliced = false;
+        for (int d = 0; d < KNIGHT_MOVE_COUNT && !spliced; d++)
+        {
+            if (!(a_mask & (1 << d)))
+            {
+                continue;
+            }
+
+            int u = getMoveTarget(a, d);
+            if (BitBoard::testBit(on_path, u) || isTeleportNode(u))
+            {
+                continue;
+            }
+
+            uint8_t u_mask = m_validator->getLegalMoveMask(u);
+            for (int e = 0; e < KNIGHT_MOVE_COUNT && !spliced; e++)
+            {
+                if (!(u_mask & (1 << e)))
+                {
+                    continue;
+                }
+
+                int v = getMoveTarget(u, e);
+                if (BitBoard::testBit(on_path, v) || isTeleportNode(v) 
+                    || !isLegalMove(v, b))
+                {
+                    continue;
+                }
+
+                // Splice u and v between a and b
+                int detour[2] = { u, v };
+                path.insert(path.begin() + i + 1, detour, detour + 2);
+                BitBoard::setBit(on_path, u);
+                BitBoard::setBit(on_path, v);
+                added  += 2;
+                spliced = true;
+            }
+        }
+    }
+
+    return added;
+}
+
+/* Algorithm - Starting at a random position i, for each position until one 
+ *             segment is reversed
+ *             - For each legal move target of path[i] on the path at a 
+ *               position j after i + 1 and before the last node, if path[i + 1]
+ *               has a legal move to path[j + 1] and every move of the segment
+ *               from path[i + 1] to path[j] is legal backwards, reverse the 
+ *               segment, so path[i] moves to path[j] and path[i + 1] to 
+ *               path[j + 1]; Record the new positions of the segment nodes
+ *             - The four nodes whose moves change must not be teleport nodes
+ *
+ * Note      - Moves past barriers are not always legal backwards, so each move 
+ *             of the segment is checked; A teleport pair inside the segment is
+ *             not a legal move, so such a segment is never reversed
+ * 
+ */
+bool KnightGraph::reversePathSegment(std::vector<int> &path, 
+    std::vector<int> &positions, std::mt19937 &engine)
+{
+    int path_size = path.size();
+    if (path_size < 4)
+    {
+        return false;
+    }
+
+    std::uniform_int_distribution<int> dis(0, path_size - 1);
+    int first = dis(engine);
+    for (int k = 0; k < path_size; k++)
+    {
+        int i = (first + k) % path_size;
+        if (i + 3 >= path_size || isTeleportNode(path[i]) 
+            || isTeleportNode(path[i + 1]))
+        {
+            continue;
+        }
+
+        uint8_t mask = m_validator->getLegalMoveMask(path[i]);
+        for (int d = 0; d < KNIGHT_MOVE_COUNT; d++)
+        {
+            if (!(mask & (1 << d)))
+            {
+                continue;
+            }
+
+            int j = positions[getMoveTarget(path[i], d)];
+            if (j <= i + 1 || j + 1 >= path_size || isTeleportNode(path[j]) 
+                || isTeleportNode(path[j + 1]) 
+                || !isLegalMove(path[i + 1], path[j + 1]))
+            {
+                continue;
+            }
+
+            // Check the segment moves backwards
+            bool segment_is_legal = true;
+            for (int m = i + 1; m < j && segment_is_legal; m++)
+            {
+                segment_is_legal = isLegalMove(path[m + 1], path[m]);
+            }
+
+            if (segment_is_legal)
+            {
+                std::reverse(path.begin() + i + 1, path.begin() + j + 1);
+                for (int m = i + 1; m <= j; m++)
+                {
+                    positions[path[m]] = m;
+                }
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+/* Algorithm - Set m_rollout_pruning
+ * 
+ */
+void KnightGraph::setRolloutPruning(bool pruning)
+{
+    m_rollout_pruning = pruning;
+}
+
+/* Algorithm - Confirm the start and end points are on the board
+ *           - Call daShortestPath() and place the path in m_best_path
+ *           - Call getStartBound() to bound the number of nodes a path can 
+ *             visit, and set m_bound_reached if m_best_path already visits that
+ *             many
+ *           - Reset m_nodes values to defaults
+ * 
+ */
+bool KnightGraph::prepareLongestPath(Vertex start, Vertex end)
+{
+    if (!startAndEndAreValid(start, end))
+    {
+        std::cout << "Start or end node is invalid.\n";
+        return false;
+    }
+
+    // Call daShortestPath() and place the path in m_best_path
+    daShortestPath(start.x, start.y, end.x, end.y);
+    m_best_path.swap(m_path);
+    m_path.clear();
+
+    // Bound the number of nodes of a path; No path reaches the end node if it
+    // is not reachable
+    m_path_node_bound = getStartBound(start, end, false) + 1;
+    m_bound_reached   = reachesPathNodeBound(m_best_path);
 
-                    // Create a vector of neighbor nodes with neighbors with  
-                    // least degree and copy to next move set
-                    std::vector<Vertex> least_degree_sum_neighbors;
-                    for (unsigned int j = 0; j < next_move_set.size(); j++)
+    // Reset visited, parent, and distance status for all nodes
+    setM_nodeValsToDefaults();
+
+    return true;
+}
+
+/* Algorithm - Copy m_nodes for the node coordinates, and set the visited status
+ *             and parent node of each node to defaults
+ *           - Copy the degrees and degree sums of a board with no visited nodes
+ *           - Stamp every node with generation 0
+ *           - Set the longest path of the state to empty, with no next node for
+ *             any node
+ *           - Size the planes of the state
+ * 
+ */
+void KnightGraph::initRolloutState(RolloutState &state)
+{
+    state.nodes = m_nodes;
+    for (unsigned int i = 0; i < state.nodes.size(); i++)
+    {
+        state.nodes[i].visited    = false;
+        state.nodes[i].parent_num = -1;
+    }
+
+    state.degrees     = m_base_degrees;
+    state.degree_sums = m_base_degree_sums;
+    state.generation  = 0;
+    state.stamps.assign(m_node_count, 0);
+
+    state.longest_path.clear();
+    state.longest_next.assign(m_node_count, -1);
+
+    int word_count = m_bitboard->getWordCount();
+    state.unvisited.assign(word_count, 0);
+    state.end_reachable.assign(word_count, 0);
+    state.frontier.assign(word_count, 0);
+    state.sources.assign(word_count, 0);
+    state.targets.assign(word_count, 0);
+}
+
+/* Algorithm - Set the next node of each node on the old longest path of the 
+ *             state to -1
+ *           - Copy path to the longest path of the state
+ *           - Walk the path backwards, setting the next node of each node to 
+ *             the node after it, or -1 for the last node, so a node on the 
+ *             path more than once keeps the node after its first appearance
+ * 
+ */
+void KnightGraph::setRolloutLongestPath(std::vector<Vertex> &path, 
+    RolloutState &state)
+{
+    for (unsigned int i = 0; i < state.longest_path.size(); i++)
+    {
+        state.longest_next[state.longest_path[i].number] = -1;
+    }
+
+    state.longest_path = path;
+
+    int next_node = -1;
+    for (int i = static_cast<int>(path.size()) - 1; i >= 0; i--)
+    {
+        state.longest_next[path[i].number] = next_node;
+        next_node = path[i].number;
+    }
+}
+
+/* Algorithm - If the path has fewer entries than m_path_node_bound, it cannot
+ *             visit that many nodes
+ *           - Otherwise sort the node numbers of the path and count the 
+ *             distinct ones
+ *
+ * Note      - The nodes are only counted for a path that may reach the bound,
+ *             so a new longest path is rarely sorted
+ * 
+ */
+bool KnightGraph::reachesPathNodeBound(const std::vector<Vertex> &path) const
+{
+    if (static_cast<int>(path.size()) < m_path_node_bound)
+    {
+        return false;
+    }
+
+    std::vector<int> numbers(path.size());
+    for (unsigned int i = 0; i < path.size(); i++)
+    {
+        numbers[i] = path[i].number;
+    }
+    std::sort(numbers.begin(), numbers.end());
+
+    int node_count = std::unique(numbers.begin(), numbers.end()) 
+        - numbers.begin();
+
+    return node_count >= m_path_node_bound;
+}
+
+/* Algorithm - If the stamp of the node is not the generation of the state, set
+ *             the visited status, parent node, degree and degree sum of the 
+ *             node to their values with no visited nodes and stamp it with the
+ *             generation of the state
+ * 
+ * Note      - Only the nodes that were stamped can have a degree or degree sum
+ *             different from a board with no visited nodes, since 
+ *             visitRolloutNode() stamps every node it changes
+ * 
+ */
+void KnightGraph::touchRolloutNode(int number, RolloutState &state)
+{
+    if (state.stamps[number] != state.generation)
+    {
+        state.nodes[number].visited    = false;
+        state.nodes[number].parent_num = -1;
+        state.degrees[number]          = m_base_degrees[number];
+        state.degree_sums[number]      = m_base_degree_sums[number];
+        state.stamps[number]           = state.generation;
+    }
+}
+
+/* Algorithm - Loop through longest path algorithm searches times, or until 
+ *             m_bound_reached is set
+ *             - Call runRollout() to build a path, avoiding the longest path 
+ *               of the state
+ *             - If the path reaches the end node and is longer than the longest
+ *               path of the state, make it the longest path of the state; If 
+ *               it visits m_path_node_bound distinct nodes, set 
+ *               m_bound_reached
+ * 
+ */
+void KnightGraph::runRolloutWorker(Vertex start, Vertex end, int searches, 
+    RolloutState &state)
+{
+    for (int i = 0; i < searches && !m_bound_reached; i++)
+    {
+        runRollout(start, end, state);
+
+        if (state.path.size() > state.longest_path.size() 
+            && state.path.back().number == end.number)
+        {
+            setRolloutLongestPath(state.path, state);
+
+            // No path can visit more nodes
+            if (reachesPathNodeBound(state.longest_path))
+            {
+                m_bound_reached = true;
+            }
+        }
+    }
+}
+
+/* Algorithm - Start a new generation of the state, so every node reads as 
+ *             unvisited with the degrees and degree sums of a board with no 
+ *             visited nodes; If the generation wraps around to 0, reset every
+ *             node of the state
+ *           - Set every passable node unvisited in state.unvisited
+ *           - While the end node has not been reached and there are unvisited
+ *             nodes to explore
+ *             - Call visitRolloutNode() to mark the current node visited
+ *             - If pruning is on, call markEndReachableNodes() so only moves 
+ *             that can still reach the end node are considered
+ *             - Build path using heuristic of choosing next node having least 
+ *             degree
+ *             - Tiebreak 1: Choose the least degree neighbors with the least 
+ *             degree sum
+ *             - Tiebreak 2: If current node and the next node is on the 
+ *             previous longest path, choose another node; The next node is 
+ *             looked up in state.longest_next
+ *             - Tiebreak 3: Choose a node at random with the engine of the 
+ *             state
+ *             - Set the next node parent_num as the current node
+ *             - Set the current_node to next_node
+ *           - Build path in reverse order from end node into state.path
+ *
+ * Note      - The candidate moves are kept in fixed arrays, so a step does not 
+ *             allocate memory
+ * 
+ */
+void KnightGraph::runRollout(Vertex start, Vertex end, RolloutState &state)
+{
+    // Start a new generation of the state
+    state.generation++;
+    if (state.generation == 0)
+    {
+        initRolloutState(state);
+    }
+    state.path.clear();
+    state.unvisited = m_bitboard->getPassablePlane();
+
+    // Build path using heuristic of choosing next node having least degree
+    int  current_node        = start.number;
+    bool are_unvisited_nodes = true;
+    while (current_node != end.number && are_unvisited_nodes)
+    {
+        // Mark current node visited
+        visitRolloutNode(current_node, state);
+
+        // Find the nodes that can still reach the end node
+        if (m_rollout_pruning)
+        {
+            markEndReachableNodes(current_node, end.number, state);
+        }
+
+        // Choose move to unvisited node with least degree
+        int next_move_set[KNIGHT_MOVE_COUNT];
+        int next_move_count = 
+            getLeastDegreeNeighbors(current_node, state, next_move_set);
+
+        if (next_move_count == 0)
+        {
+            // No unvisited nodes available for move from this position
+            are_unvisited_nodes = false;
+        }
+        else
+        {
+            // Check if tiebreakers are needed
+            // Tiebreak 1 - Choose the least degree neighbors with the least
+            //              sum of degrees of their neighbors
+            if (next_move_count > 1)
+            {
+                int least_degree_sum = std::numeric_limits<int>::max();
+                for (int j = 0; j < next_move_count; j++)
+                {
+                    int sum = state.degree_sums[next_move_set[j]];
+
+                    // Set least degree sum if necessary
+                    if (sum < least_degree_sum)
                     {
-                        if (degree_sums[j] == least_degree_sum)
-                        {
-                            least_degree_sum_neighbors.push_back(
-                                next_move_set[j]);
-                        }
+                        least_degree_sum = sum;
                     }
-                    next_move_set = least_degree_sum_neighbors;
                 }
 
-                // Tiebreak 2 if current node and the next node is on the 
-                // previous longest path, choose another node
-                std::vector<Vertex> longest_path = 
-                    getLongestPathFromPathStore(end);
-                result = std::find_if(longest_path.begin(), longest_path.end(), 
-                    match_num(current_node.number));
-                if (result != longest_path.end())
+                // Keep the neighbor nodes with the least degree sum
+                int kept = 0;
+                for (int j = 0; j < next_move_count; j++)
                 {
-                    // Advance result to next node and check if it matches any  
-                    // in the move set
-                    std::vector<Vertex> nodes_not_on_earlier_path;
-                    ++result;
-                    for (unsigned int j = 0; j < next_move_set.size(); j++)
+                    if (state.degree_sums[next_move_set[j]] == least_degree_sum)
                     {
-                        if (result->number != next_move_set[j].number)
-                        {
-                            nodes_not_on_earlier_path.push_back(
-                                next_move_set[j]);
-                        }
+                        next_move_set[kept] = next_move_set[j];
+                        kept++;
                     }
-                    
-                    if (nodes_not_on_earlier_path.size() > 0)
+                }
+                next_move_count = kept;
+            }
+
+            // Tiebreak 2 if current node and the next node is on the 
+            // previous longest path, choose another node
+            int longest_next = state.longest_next[current_node];
+            if (longest_next != -1)
+            {
+                // Check if the next node on the longest path matches any in 
+                // the move set
+                int nodes_not_on_earlier_path[KNIGHT_MOVE_COUNT];
+                int kept = 0;
+                for (int j = 0; j < next_move_count; j++)
+                {
+                    if (longest_next != next_move_set[j])
                     {
-                        next_move_set = nodes_not_on_earlier_path;
+                        nodes_not_on_earlier_path[kept] = next_move_set[j];
+                        kept++;
                     }
                 }
-
-                // Tiebreaker 3 choose a node at random
-                if (next_move_set.size() > 1)
+                
+                if (kept > 0)
                 {
-                    std::vector<Vertex> random_node;
-                    std::random_device rd;
-                    std::mt19937 engine(rd());
-                    std::uniform_int_distribution<unsigned int> 
-                        dis(0, next_move_set.size() - 1);
-                    unsigned int index = dis(engine);
-                    random_node.push_back(next_move_set[index]);
-                    next_move_set = random_node;
+                    std::copy(nodes_not_on_earlier_path, 
+                        nodes_not_on_earlier_path + kept, next_move_set);
+                    next_move_count = kept;
                 }
+            }
+
+            // Tiebreaker 3 choose a node at random
+            if (next_move_count > 1)
+            {
+                std::uniform_int_distribution<int> 
+                    dis(0, next_move_count - 1);
+                next_move_set[0] = next_move_set[dis(state.engine)];
+            }
+
+            // Set the next node parent_num as the current node
+            int next_node = next_move_set[0];
+            state.nodes[next_node].parent_num = current_node;
+
+            // Set the current_node to next_node
+            current_node = next_node;
+        }
+    }
+
+    // Build path in reverse order from end node
+    if (m_teleport_one != -1)
+    {
+        touchRolloutNode(m_teleport_one, state);
+        touchRolloutNode(m_teleport_two, state);
+    }
+    buildPathInReverse(start, state.nodes[current_node], state.nodes, 
+        state.path);
+}
+
+/* Algorithm - Mark the start node visited and push it on a DFS stack along 
+ *             with the first knight direction to check
+ *           - While the stack contains nodes:
+ *             - Check the legal moves of the node at the top of the stack, 
+ *               starting from its saved direction, for the first move to a node
+ *               that has not been visited
+ *             - If one exists, save the direction after it for the top node,
+ *               then mark the new node visited and push it on the stack
+ *             - Otherwise, pop the top node to move back to the previous node
+ *
+ * Note      - A move onto a teleport node visits the other teleport node, as 
+ *             the adjacency list connects it, so nodes only reachable through 
+ *             the teleport pair are visited
+ *           - Each node is pushed once and each of its directions is checked 
+ *             once, so the search is O(V) and its depth is not limited by the 
+ *             call stack
+ * 
+ */
+void KnightGraph::dfsVisitNext(int start_x, int start_y)
+{
+    // DFS stack of node numbers and the next direction to check for each
+    std::vector<int> node_stack;
+    std::vector<int> direction_stack;
 
-                // Set the next node parent_num as the current node
-                Vertex next_node = next_move_set[0];
-                m_nodes[next_node.number].parent_num = current_node.number;
+    // Mark start node visited and push it on the stack
+    Vertex start_node(start_x, start_y, m_board_row_size);
+    m_nodes[start_node.number].visited = true;
+    node_stack.push_back(start_node.number);
+    direction_stack.push_back(0);
+
+    while (!node_stack.empty())
+    {
+        int     current = node_stack.back();
+        uint8_t mask    = m_validator->getLegalMoveMask(current);
 
-                // Set the current_node to next_node
-                current_node = next_node;
+        // Check for first unvisited legal move from the saved direction
+        int next = -1;
+        int d    = direction_stack.back();
+        while (d < KNIGHT_MOVE_COUNT && next == -1)
+        {
+            if (mask & (1 << d))
+            {
+                int target = getLandingNode(current, d);
+                if (!m_nodes[target].visited)
+                {
+                    next = target;
+                }
             }
+            d++;
         }
 
-        // Build path in reverse order from end node
-        buildPathInReverse(start, current_node);
+        if (next != -1)
+        {
+            // Save the direction to resume from, then visit the next node
+            direction_stack.back() = d;
+            m_nodes[next].visited = true;
+            node_stack.push_back(next);
+            direction_stack.push_back(0);
+        }
+        else
+        {
+            // No unvisited legal moves exist; Move back one node
+            node_stack.pop_back();
+            direction_stack.pop_back();
+        }
+    }
+}
+
+/* Algorithm - Clear the adjacency list
+ *           - Loop through the nodes in order of node number:
+ *             - Set the node offset to the current number of packed edges
+ *             - If the node was visited, call getNodeEdges() and append the 
+ *               edges to the packed targets and weights
+ *           - Set the final offset to the total number of packed edges
+ * 
+ */
+void KnightGraph::buildAdjacencyList()
+{
+    m_adj_offsets.assign(m_node_count + 1, 0);
+    m_adj_targets.clear();
+    m_adj_weights.clear();
+
+    for (int n = 0; n < m_node_count; n++)
+    {
+        m_adj_offsets[n] = m_adj_targets.size();
+
+        if (!m_nodes[n].visited)
+        {
+            continue;
+        }
 
-        // Add path to m_path_store then clear m_path
-        m_path_store.push_back(m_path);
-        m_path.clear();
+        // A knight has at most 8 moves, so the edges fit in fixed arrays
+        int targets[KNIGHT_MOVE_COUNT];
+        int weights[KNIGHT_MOVE_COUNT];
+        int edge_count = getNodeEdges(n, targets, weights);
 
-        // Reset m_nodes values to defaults
-        setM_nodeValsToDefaults();
+        // Append the edges to the packed arrays
+        m_adj_targets.insert(m_adj_targets.end(), targets, targets + edge_count);
+        m_adj_weights.insert(m_adj_weights.end(), weights, weights + edge_count);
     }
 
-    // Copy longest path from m_node_store to m_path
-    std::vector<Vertex> longest_path = getLongestPathFromPathStore(end);
-    m_path = longest_path;
+    m_adj_offsets[m_node_count] = m_adj_targets.size();
+
+    setAdjacencyData();
 }
 
-/* Algorithm - Mark current node visited and add to m_path
- *           - Get the legal moves available from the current node
- *           - Add node connections to adjancency matrix
- *           - Check for the first node of the returned list of moves that has 
- *             not been visited
- *           - If no unvisited legal moves exist, move back one node and check 
- *             for unvisited nodes
- *           - If beginning of path has been reached and no unvisited nodes 
- *             exist, return (base case)
- *           - Otherwise, set next_x and next_y to the next unvisited legal move
- *           - Visit next_x and next_y (recursive call)
+/* Algorithm - Point the searches to the adjacency list of the graph file if 
+ *             there is one, otherwise to the adjacency list vectors
  * 
  */
-void KnightGraph::dfsVisitNext(int start_x, int start_y)
+void KnightGraph::setAdjacencyData()
 {
-    // Create Vertex for current node
-    Vertex current_node(start_x, start_y, m_board_row_size);
-
-    // Mark current node visited and add to m_path
-    auto result = std::find_if(
-        m_nodes.begin(), m_nodes.end(), match_num(current_node.number));
-    if (result != m_nodes.end())
+    if (m_graph_file)
     {
-        result->visited = true;
-        m_path.push_back(current_node);
+        m_csr_offsets    = m_graph_file->getAdjOffsets();
+        m_csr_targets    = m_graph_file->getAdjTargets();
+        m_csr_weights    = m_graph_file->getAdjWeights();
+        m_csr_edge_count = m_graph_file->getEdgeCount();
     }
+    else
+    {
+        m_csr_offsets    = m_adj_offsets.data();
+        m_csr_targets    = m_adj_targets.data();
+        m_csr_weights    = m_adj_weights.data();
+        m_csr_edge_count = m_adj_targets.size();
+    }
+}
 
-    // Get available legal moves
-    std::vector<Vertex> legal_moves = m_validator->getLegalMoves(current_node);
+/* Algorithm - Get the legal move mask of the node
+ *           - For each legal move, determine the target and weight of the edge 
+ *             by the node type of the legal move node; A move to a teleport 
+ *             node connects to the other teleport node
+ *           - Insert each edge in order of target node number, dropping 
+ *             repeated targets
+ * 
+ */
+int KnightGraph::getNodeEdges(int number, int *targets, int *weights)
+{
+    // Get the legal move mask of the node
+    uint8_t mask = m_validator->getLegalMoveMask(number);
+    int edge_count = 0;
 
-    // Add node connections to adjancency matrix
-    for (unsigned int i = 0; i < legal_moves.size(); i++)
+    for (int d = 0; d < KNIGHT_MOVE_COUNT; d++)
     {
-        // Get the node tyoe of the legal move node
-        char node_type = m_board[legal_moves[i].y][legal_moves[i].x];
+        if (!(mask & (1 << d)))
+        {
+            continue;
+        }
 
-        // Determine what the edge weight will be for the adj matrix connection
+        // Get the node type of the legal move node
+        int  target    = getMoveTarget(number, d);
+        char node_type = m_board.getCell(m_nodes[target].x, m_nodes[target].y);
+        int  weight    = 1;
+
+        // Determine what the edge weight will be for the adj list connection
         switch(node_type)
         {
             case 'W':
             {
-                m_adj_matrix[current_node.number][legal_moves[i].number] 
-                    = WATER_NODE_WEIGHT;
+                weight = WATER_NODE_WEIGHT;
                 break;
             }
             case 'L':
             {
-                m_adj_matrix[current_node.number][legal_moves[i].number] 
-                    = LAVA_NODE_WEIGHT;
+                weight = LAVA_NODE_WEIGHT;
                 break;
             }
             case 'T': // Teleport node - connect to other teleport node
             {
-                // Retrieve other T node number
-                Vertex teleport_node = 
-                    m_validator->getTeleportNode(legal_moves[i]);
-                // Add connection to retrieved node in matrix rather than 
-                // current T node from legal_moves
-                m_adj_matrix[current_node.number][teleport_node.number] = 1;
+                // Add connection to the other T node rather than the T node of
+                // the legal move
+                if (target == m_teleport_one)
+                {
+                    target = m_teleport_two;
+                }
+                else if (target == m_teleport_two)
+                {
+                    target = m_teleport_one;
+                }
                 break;
             }
             default: // '.' character - normal node
             {
-                m_adj_matrix[current_node.number][legal_moves[i].number] = 1;
+                // Weight of 1
             }
         }
 
-    }
+        // Insert the edge in target order; A repeated target keeps the latest
+        // weight
+        int j = edge_count;
+        while (j > 0 && targets[j - 1] > target)
+        {
+            j--;
+        }
 
-    // Check for first unvisited legal move
-    int position = -1;
-    for (unsigned int i = 0; i < legal_moves.size(); i++)
-    {
-        auto result = std::find_if(m_nodes.begin(), m_nodes.end(), 
-            match_num(legal_moves[i].number));
-        if ((result != m_nodes.end()) && !result->visited)
+        if (j > 0 && targets[j - 1] == target)
         {
-            position = i;
-            i = legal_moves.size();
+            weights[j - 1] = weight;
+        }
+        else
+        {
+            for (int k = edge_count; k > j; k--)
+            {
+                targets[k] = targets[k - 1];
+                weights[k] = weights[k - 1];
+            }
+            targets[j] = target;
+            weights[j] = weight;
+            edge_count++;
         }
     }
 
-    // Determine next node
-    int next_x = -1;
-    int next_y = -1;
+    return edge_count;
+}
+
+/* Algorithm - Count the edges into each node, then convert the counts into 
+ *             offsets
+ *           - Loop through the adjacency list in order of source node and 
+ *             place each edge at the next free index of its target node
+ * 
+ */
+void KnightGraph::buildReverseAdjacencyList()
+{
+    m_rev_adj_offsets.assign(m_node_count + 1, 0);
+    m_rev_adj_sources.resize(m_csr_edge_count);
+    m_rev_adj_weights.resize(m_csr_edge_count);
+
+    // Count the edges into each node
+    for (int e = 0; e < m_csr_edge_count; e++)
+    {
+        m_rev_adj_offsets[m_csr_targets[e] + 1]++;
+    }
 
-    if (position != -1)
+    for (int n = 0; n < m_node_count; n++)
     {
-        next_x = legal_moves[position].x;
-        next_y = legal_moves[position].y;
+        m_rev_adj_offsets[n + 1] += m_rev_adj_offsets[n];
     }
-    else
+
+    // Place each edge in its target node's range
+    std::vector<int> next_index(m_rev_adj_offsets.begin(), 
+        m_rev_adj_offsets.end() - 1);
+    for (int n = 0; n < m_node_count; n++)
     {
-        // No unvisited legal moves exist; Move back one node and check for move
+        for (int e = m_csr_offsets[n]; e < m_csr_offsets[n + 1]; e++)
+        {
+            int index = next_index[m_csr_targets[e]]++;
 
-        // Pop current node off path
-        m_path.pop_back();
+            m_rev_adj_sources[index] = n;
+            m_rev_adj_weights[index] = m_csr_weights[e];
+        }
+    }
+}
+
+/* Algorithm - Loop through the unvisited legal move targets of the node, 
+ *             skipping those not in state.end_reachable if pruning is on, and
+ *             keeping the least degree found and the targets with that degree
+ *           - Return the number of targets with the least degree
+ * 
+ */
+int KnightGraph::getLeastDegreeNeighbors(int number, RolloutState &state, 
+    int *neighbors)
+{
+    // Retrieve the legal move mask for the node
+    uint8_t mask = m_validator->getLegalMoveMask(number);
 
-        if (!m_path.empty())
+    int least_degree   = std::numeric_limits<int>::max();
+    int neighbor_count = 0;
+    for (int d = 0; d < KNIGHT_MOVE_COUNT; d++)
+    {
+        if (!(mask & (1 << d)))
         {
-            // Retrieves coordinates of previous node
-            next_x = m_path.back().x;
-            next_y = m_path.back().y;
+            continue;
         }
-        else
+
+        int target = getMoveTarget(number, d);
+        touchRolloutNode(target, state);
+        if (state.nodes[target].visited 
+            || (m_rollout_pruning 
+                && !BitBoard::testBit(state.end_reachable, target)))
         {
-            // The path is empty after popping the current node off; The graph
-            // has been fully explored
+            continue;
+        }
 
-            return;
+        // Restart the neighbors if the degree is less than the least degree
+        int degree = state.degrees[target];
+        if (degree < least_degree)
+        {
+            least_degree   = degree;
+            neighbor_count = 0;
         }
 
-        // Pop previous node off path so it is not added twice
-        m_path.pop_back();
+        if (degree == least_degree)
+        {
+            neighbors[neighbor_count] = target;
+            neighbor_count++;
+        }
     }
 
-    // Visit next node
-    dfsVisitNext(next_x, next_y);
+    return neighbor_count;
 }
 
-/* Algorithm - Retrieve the legal moves for the start position
- *           - Instantiate an unsigned int with the max value for least degree
- *           - Loop through the vector of legal moves, retrieve the legal moves 
- *             for each of thoses moves, storing value in degree vector
- *             - If the degree of the move being checked is less than the least 
- *               degree, set least degree to that value
- *           - Return a vector of Vertex with the unvisited least degree 
- *             legal moves
+/* Algorithm - Mark the node visited, and clear its bit in state.unvisited
+ *           - For each node with a legal move onto the node (a source node):
+ *             - Remove the degree of the node from the degree sum of the 
+ *               source node, since the node is no longer an unvisited target
+ *             - Decrement the degree of the source node
+ *             - If the source node is unvisited, decrement the degree sum of
+ *               each node with a legal move onto the source node, since the 
+ *               degree of one of its unvisited targets went down by one
+ * 
+ * Note      - Legal moves are not symmetric when barriers are in the path, so 
+ *             the source nodes are found with the reverse legal move masks
  * 
  */
-std::vector<Vertex> KnightGraph::getLeastDegreeNeighbors(Vertex start)
+void KnightGraph::visitRolloutNode(int number, RolloutState &state)
 {
-    // Retrieve the legal moves for the start position
-    std::vector<Vertex> legal_moves = m_validator->getLegalMoves(start);
+    touchRolloutNode(number, state);
+    state.nodes[number].visited = true;
+    BitBoard::clearBit(state.unvisited, number);
 
-    // Create a vector of unvisited legal move nodes
-    std::vector<Vertex> uv_legal_moves;
-    for (unsigned int i = 0; i < legal_moves.size(); i++)
+    uint8_t rev_mask = m_rev_move_masks[number];
+    for (int d = 0; d < KNIGHT_MOVE_COUNT; d++)
     {
-        if (!(m_nodes[legal_moves[i].number].visited))
+        if (!(rev_mask & (1 << d)))
         {
-            uv_legal_moves.push_back(legal_moves[i]);
+            continue;
         }
-    }
 
-    // Retrieve the number of legal moves for each of the legal moves
-    unsigned int least_degree = std::numeric_limits<int>::max();
-    std::vector<unsigned int> uv_legal_moves_degrees;
-    for (unsigned int i = 0; i < uv_legal_moves.size(); i++)
-    {
-        std::vector<Vertex> conn_uv_legal_moves = 
-            m_validator->getLegalMoves(uv_legal_moves[i]);
+        // The opposite direction of direction d is direction d + 4
+        int source = getMoveTarget(number, (d + 4) % KNIGHT_MOVE_COUNT);
+        touchRolloutNode(source, state);
+
+        state.degree_sums[source] -= state.degrees[number];
+        state.degrees[source]--;
 
-        // Create a vector of unvisited connections to unvisited legal moves
-        std::vector<Vertex> uv_conn_uv_legal_moves;
-        for (unsigned int j = 0; j < conn_uv_legal_moves.size(); j++)
+        if (state.nodes[source].visited)
         {
-            if (!m_nodes[conn_uv_legal_moves[j].number].visited)
+            continue;
+        }
+
+        uint8_t source_rev_mask = m_rev_move_masks[source];
+        for (int e = 0; e < KNIGHT_MOVE_COUNT; e++)
+        {
+            if (source_rev_mask & (1 << e))
             {
-                uv_conn_uv_legal_moves.push_back(conn_uv_legal_moves[j]);
+                int source_source = getMoveTarget(source, 
+                    (e + 4) % KNIGHT_MOVE_COUNT);
+                touchRolloutNode(source_source, state);
+                state.degree_sums[source_source]--;
             }
         }
+    }
+}
+
+/* Algorithm - Collect the unvisited legal move targets of the node in 
+ *             state.targets
+ *           - If there is at most one target, mark the targets reachable; If 
+ *             the node can reach the end node, the only target is the first 
+ *             move of the way there
+ *           - Otherwise start state.end_reachable and the frontier with the 
+ *             end node, and flood the unvisited nodes backwards from the end 
+ *             node with expandFrontierReverse() and mergeFrontier() until no 
+ *             new node is found or every target was reached
+ * 
+ */
+void KnightGraph::markEndReachableNodes(int number, int end_number, 
+    RolloutState &state)
+{
+    std::fill(state.end_reachable.begin(), state.end_reachable.end(), 0);
+    std::fill(state.targets.begin(), state.targets.end(), 0);
+
+    // Collect the unvisited legal move targets of the node
+    uint8_t mask         = m_validator->getLegalMoveMask(number);
+    int     target_count = 0;
+    for (int d = 0; d < KNIGHT_MOVE_COUNT; d++)
+    {
+        int target = getMoveTarget(number, d);
+        if ((mask & (1 << d)) && BitBoard::testBit(state.unvisited, target))
+        {
+            BitBoard::setBit(state.targets, target);
+            target_count++;
+        }
+    }
+
+    if (target_count <= 1)
+    {
+        state.end_reachable.swap(state.targets);
+        return;
+    }
 
-        // Store the degree of the node in the vector of degrees
-        unsigned int degree = uv_conn_uv_legal_moves.size();
-        uv_legal_moves_degrees.push_back(degree);
+    // Flood the unvisited nodes backwards from the end node
+    std::fill(state.frontier.begin(), state.frontier.end(), 0);
+    BitBoard::setBit(state.end_reachable, end_number);
+    BitBoard::setBit(state.frontier, end_number);
 
-        // Set least degree if necessary
-        if (degree < least_degree)
+    while (true)
+    {
+        m_bitboard->expandFrontierReverse(state.frontier, state.sources);
+        if (!BitBoard::mergeFrontier(state.sources, state.unvisited, 
+            state.end_reachable))
         {
-            least_degree = degree;
+            break;
+        }
+        state.frontier.swap(state.sources);
+
+        // Stop once every target was reached
+        bool all_reached = true;
+        for (unsigned int i = 0; i < state.targets.size() && all_reached; i++)
+        {
+            all_reached = ((state.targets[i] & ~state.end_reachable[i]) == 0);
+        }
+        if (all_reached)
+        {
+            break;
         }
     }
+}
 
-    // Retrieve unvisited nodes with the least degree and return them
-    std::vector<Vertex> least_degree_neighbors;
-    for (unsigned int i = 0; i < uv_legal_moves.size(); i++)
+/* Algorithm - Construct a Vertex struct for each node and record the teleport
+ *             nodes; A single teleport node has no pair
+ *           - Construct the MoveValidator and BitBoard objects over m_board;
+ *             The MoveValidator uses the legal move masks of the graph file if
+ *             there is one
+ *           - Call setAdjacencyData() to point the searches to the adjacency
+ *             list
+ *           - Build the degree tables of the longest path searches
+ * 
+ */
+void KnightGraph::initGraph()
+{
+    // Construct vector of Vertex structs
+    for (int i = 0; i < m_board.getRowCount(); i++)
     {
-        if (uv_legal_moves_degrees[i] == least_degree)
+        for (int j = 0; j < m_board_row_size; j++)
         {
-            least_degree_neighbors.push_back(uv_legal_moves[i]);
+            Vertex vert(j, i, m_board_row_size);
+            m_nodes.push_back(vert);
+
+            // Record the teleport nodes
+            if (m_board.getCell(j, i) == 'T' && m_teleport_one == -1)
+            {
+                m_teleport_one = vert.number;
+            }
+            else if (m_board.getCell(j, i) == 'T')
+            {
+                m_teleport_two = vert.number;
+            }
         }
     }
 
-    return least_degree_neighbors;
+    // A single teleport node has no pair
+    if (m_teleport_two == -1)
+    {
+        m_teleport_one = -1;
+    }
+
+    // Initialize MoveValidator object, over the masks of the graph file if
+    // there is one
+    if (m_graph_file)
+    {
+        m_validator = new MoveValidator(m_board, m_graph_file->getMoveMasks());
+    }
+    else
+    {
+        m_validator = new MoveValidator(m_board);
+    }
+
+    // Point the searches to the adjacency list
+    setAdjacencyData();
+
+    // Initialize BitBoard object from the legal move masks
+    m_bitboard = new BitBoard(m_board, m_validator);
+
+    // Build the tables used to keep the degrees of the longest path searches
+    buildDegreeTables();
 }
 
-/* Algorithm - Retrieve the unvisited legal moves for the start position
- *           - Instantiate an unsigned int for the sum of degrees
- *           - Loop through the vector of legal moves, retrieve the legal moves 
- *             for each of thoses moves, storing value in degree vector
- *           - Return a sum of the vector degrees
+/* Algorithm - For each node and each legal move of the node, set the bit of
+ *             the move direction in the reverse legal move mask of the target 
+ *             node
+ *           - The degree of each node is the number of its legal moves
+ *           - The degree sum of each node is the sum of the degrees of its 
+ *             legal move targets
  * 
  */
-int KnightGraph::getSumOfDegreesOfNeighbors(Vertex start)
+void KnightGraph::buildDegreeTables()
 {
-    // Retrieve the legal moves for the start position
-    std::vector<Vertex> legal_moves = m_validator->getLegalMoves(start);
+    m_rev_move_masks.assign(m_node_count, 0);
+    m_base_degrees.assign(m_node_count, 0);
+    m_base_degree_sums.assign(m_node_count, 0);
 
-    // Create a vector of unvisited legal move nodes
-    std::vector<Vertex> uv_legal_moves;
-    for (unsigned int i = 0; i < legal_moves.size(); i++)
+    for (int n = 0; n < m_node_count; n++)
     {
-        if (!m_nodes[legal_moves[i].number].visited)
+        uint8_t mask = m_validator->getLegalMoveMask(n);
+        for (int d = 0; d < KNIGHT_MOVE_COUNT; d++)
         {
-            uv_legal_moves.push_back(legal_moves[i]);
+            if (mask & (1 << d))
+            {
+                m_rev_move_masks[getMoveTarget(n, d)] |= (1 << d);
+                m_base_degrees[n]++;
+            }
         }
     }
 
-    // Retrieve the number of legal moves for each of the legal moves
-    std::vector<unsigned int> uv_legal_moves_degrees;
-    for (unsigned int i = 0; i < uv_legal_moves.size(); i++)
+    for (int n = 0; n < m_node_count; n++)
     {
-        std::vector<Vertex> conn_uv_legal_moves = 
-            m_validator->getLegalMoves(uv_legal_moves[i]);
-
-        // Create a vector of unvisited connections to unvisited legal moves
-        std::vector<Vertex> uv_conn_uv_legal_moves;
-        for (unsigned int j = 0; j < conn_uv_legal_moves.size(); j++)
+        uint8_t mask = m_validator->getLegalMoveMask(n);
+        for (int d = 0; d < KNIGHT_MOVE_COUNT; d++)
         {
-            if (!m_nodes[conn_uv_legal_moves[j].number].visited)
+            if (mask & (1 << d))
             {
-                uv_conn_uv_legal_moves.push_back(conn_uv_legal_moves[j]);
+                m_base_degree_sums[n] += m_base_degrees[getMoveTarget(n, d)];
             }
         }
+    }
+}
+
+/* Algorithm - Binary search the word indices stored for the level for the word
+ *             of the node, then check the bit of the node in that word
+ * 
+ */
+bool KnightGraph::levelContains(int level, int number)
+{
+    int word  = number >> 6;
+    int first = m_level_offsets[level];
+    int last  = m_level_offsets[level + 1];
 
-        // Store the degree of the node in the vector of degrees
-        unsigned int degree = uv_conn_uv_legal_moves.size();
-        uv_legal_moves_degrees.push_back(degree);
+    auto result = std::lower_bound(m_level_word_indices.begin() + first, 
+        m_level_word_indices.begin() + last, word);
+    if (result == m_level_word_indices.begin() + last || *result != word)
+    {
+        return false;
     }
 
-    // Sum vector of degrees and return it
-    int sum = static_cast<int>(std::accumulate(uv_legal_moves_degrees.begin(),
-        uv_legal_moves_degrees.end(), 0));
+    uint64_t bits = m_level_words[result - m_level_word_indices.begin()];
+    return ((bits >> (number & 63)) & 1) != 0;
+}
 
-    return sum;
+/* Algorithm - Add the row and column offsets of the knight direction to the 
+ *             node number
+ * 
+ */
+int KnightGraph::getMoveTarget(int number, int direction)
+{
+    return number + (KNIGHT_MOVE_Y[direction] * m_board_row_size) 
+        + KNIGHT_MOVE_X[direction];
 }
 
-/* Algorithm - Set values for visited, distance, and parent node to defaults
+/* Algorithm - Retrieve the target of the move with getMoveTarget()
+ *           - If the target is a teleport node, return the other teleport node
  * 
  */
-void KnightGraph::setM_nodeValsToDefaults()
+int KnightGraph::getLandingNode(int number, int direction)
 {
-    for (unsigned int i = 0; i < m_nodes.size(); i++)
+    int target = getMoveTarget(number, direction);
+
+    if (target == m_teleport_one)
+    {
+        target = m_teleport_two;
+    }
+    else if (target == m_teleport_two)
+    {
+        target = m_teleport_one;
+    }
+
+    return target;
+}
+
+/* Algorithm - Check that the start and end nodes are on the board and that 
+ *             neither is a rock or a barrier
+ * 
+ */
+bool KnightGraph::startAndEndAreValid(Vertex start, Vertex end)
+{
+    bool start_is_on_board = m_validator->isOnBoard(start);
+    bool end_is_on_board   = m_validator->isOnBoard(end);
+    bool start_is_rock     = m_validator->isRock(start);
+    bool end_is_rock       = m_validator->isRock(end);
+    bool start_is_barrier  = m_validator->isBarrier(start);
+    bool end_is_barrier    = m_validator->isBarrier(end);
+
+    return (start_is_on_board && end_is_on_board && !start_is_rock 
+        && !end_is_rock && !start_is_barrier && !end_is_barrier);
+}
+
+/* Algorithm - Order the absolute coordinate differences so dx >= dy
+ *           - Handle the two cases near the origin that need extra moves
+ *           - Otherwise, use the closed form: with delta = dx - dy, the 
+ *             distance is delta - 2 * floor((delta - dy) / 3) when dy > delta, 
+ *             and delta - 2 * floor((delta - dy) / 4) otherwise
+ * 
+ */
+int KnightGraph::getKnightDistance(int from, int to)
+{
+    int dx = std::abs(m_nodes[from].x - m_nodes[to].x);
+    int dy = std::abs(m_nodes[from].y - m_nodes[to].y);
+
+    if (dx < dy)
+    {
+        std::swap(dx, dy);
+    }
+
+    if (dx == 1 && dy == 0)
+    {
+        return 3;
+    }
+
+    if (dx == 2 && dy == 2)
+    {
+        return 4;
+    }
+
+    int delta = dx - dy;
+    if (dy > delta)
+    {
+        // delta - dy is negative here; Round the division towards -infinity
+        return delta + (2 * ((dy - delta + 2) / 3));
+    }
+
+    return delta - (2 * ((delta - dy) / 4));
+}
+
+/* Algorithm - Take the knight distance to the end node
+ *           - If the board has a teleport pair, also take the knight distance 
+ *             to either teleport node plus the knight distance from the other 
+ *             teleport node to the end node, and keep the least
+ *           - Scale the number of moves by the min edge weight
+ * 
+ */
+int KnightGraph::getDistanceEstimate(int number, int end_number, 
+    int min_weight)
+{
+    int moves = getKnightDistance(number, end_number);
+
+    if (m_teleport_one != -1)
     {
-        m_nodes[i].visited    = false;
-        m_nodes[i].distance   = std::numeric_limits<int>::max();
-        m_nodes[i].parent_num = -1;
+        int through_one = getKnightDistance(number, m_teleport_one) 
+            + getKnightDistance(m_teleport_two, end_number);
+        int through_two = getKnightDistance(number, m_teleport_two) 
+            + getKnightDistance(m_teleport_one, end_number);
+
+        moves = std::min(moves, std::min(through_one, through_two));
     }
+
+    return moves * min_weight;
 }
 
-/* Algorithm - Find the size of the longest path in m_path_store with end as the
- *             last node
- *           - Return the last path equal to the longest path
+/* Algorithm - Increment the generation, so every node stamped with an earlier
+ *             generation reads as default values from getNode()
+ *           - If the generation wraps around to 0, set values for visited, 
+ *             distance, and parent node to defaults for all nodes and stamp 
+ *             them with generation 0
  * 
  */
-std::vector<Vertex> KnightGraph::getLongestPathFromPathStore(Vertex end)
+void KnightGraph::setM_nodeValsToDefaults()
 {
-    // Find the size of the longest path in m_path_store
-    unsigned int longest_path_size  = 0;
-    unsigned int longest_path_index = 0;
-    for (unsigned int i = 0; i < m_path_store.size(); i++)
+    m_generation++;
+
+    // Clear every node once the generation wraps around to 0
+    if (m_generation == 0)
     {
-        if (m_path_store[i].size() > longest_path_size 
-            && m_path_store[i].back().number == end.number)
+        for (unsigned int i = 0; i < m_nodes.size(); i++)
         {
-            longest_path_size  = m_path_store[i].size();
-            longest_path_index = i;
+            m_nodes[i].visited    = false;
+            m_nodes[i].distance   = std::numeric_limits<int>::max();
+            m_nodes[i].parent_num = -1;
+            m_node_stamps[i]      = 0;
         }
     }
+}
 
-    // Return the path with the largest index equal to the longest path size
-    std::vector<Vertex> longest_path = m_path_store[longest_path_index];
+/* Algorithm - If the stamp of the node is not the current generation, set the 
+ *             distance, parent node, and visited of the node to default values
+ *             and stamp it with the current generation
+ *           - Return the node
+ * 
+ */
+Vertex &KnightGraph::getNode(int number)
+{
+    if (m_node_stamps[number] != m_generation)
+    {
+        m_nodes[number].visited    = false;
+        m_nodes[number].distance   = std::numeric_limits<int>::max();
+        m_nodes[number].parent_num = -1;
+        m_node_stamps[number]      = m_generation;
+    }
 
-    return longest_path;
+    return m_nodes[number];
 }
 
-/* Algorithm - Build the path in reverse from the end node and store in m_path
+/* Algorithm - Reset the end node and the teleport nodes if an earlier 
+ *             generation last used them; The other nodes on the path were used
+ *             by the search that set their parent nodes
+ *           - Build the path from the parent nodes of m_nodes into m_path
  * 
  */
 void KnightGraph::buildPathInReverse(Vertex start, Vertex end)
+{
+    getNode(end.number);
+    if (m_teleport_one != -1)
+    {
+        getNode(m_teleport_one);
+        getNode(m_teleport_two);
+    }
+
+    buildPathInReverse(start, end, m_nodes, m_path);
+}
+
+/* Algorithm - Starting at the end node, add each node to the path and move to
+ *             its parent until the start node is added
+ *             - If a teleport node other than the start node is encountered, 
+ *               add the other teleport node to the path before moving to the 
+ *               parent
+ *           - Reverse the path
+ * 
+ */
+void KnightGraph::buildPathInReverse(Vertex start, Vertex end, 
+    std::vector<Vertex> &nodes, std::vector<Vertex> &path)
 {
     // Build path in reverse order from end node
     int node_number = end.number;
     while (node_number != -1)
     {
-        m_path.push_back(m_nodes[node_number]);
+        path.push_back(nodes[node_number]);
 
         // Set next node number to parent number of the current node
         if (node_number == start.number)
         {
             node_number = -1;
         }
-        else if (m_board[m_nodes[node_number].y][m_nodes[node_number].x] == 'T')
+        else if (m_board.getCell(nodes[node_number].x, 
+            nodes[node_number].y) == 'T')
         {
             // Other teleport node must be inserted in path
             Vertex other_teleport_node = 
-                m_validator->getTeleportNode(m_nodes[node_number]);
-            int node_after_teleport_number = m_nodes[node_number].parent_num;
-            m_path.push_back(m_nodes[other_teleport_node.number]);
+                m_validator->getTeleportNode(nodes[node_number]);
+            int node_after_teleport_number = nodes[node_number].parent_num;
+            path.push_back(nodes[other_teleport_node.number]);
             node_number = node_after_teleport_number;
         }
         else
         {
-            int next_node_number = m_nodes[node_number].parent_num;
+            int next_node_number = nodes[node_number].parent_num;
             node_number = next_node_number;
         }
     }
 
     // Reverse order of path
-    std::reverse(m_path.begin(), m_path.end());
+    std::reverse(path.begin(), path.end());
 }
 
 /* Algorithm - Return m_path
@@ -784,24 +3281,55 @@ std::vector<Vertex> KnightGraph::getPathToEnd()
     return m_path;
 }
 
+/* Algorithm - Return m_expanded_count
+ * 
+ */
+int KnightGraph::getExpandedNodeCount()
+{
+    return m_expanded_count;
+}
+
+/* Algorithm - Call calcTotalPossibleMoves() to get the max possible path length
+ *           - Call calcPathLength() to get the length of m_path
+ *           - Print the total possible path length and the percentage of the 
+ *             total length for m_path
+ * 
+ */
+void KnightGraph::printCalculatedPathLengthAndPercent()
+{
+    int total_possible_moves = calcTotalPossibleMoves();
+    std::cout << "Total possible moves on board = " << total_possible_moves 
+        << "\n";
+
+    // Calculate the length of m_path
+    int total_path_length = calcPathLength(m_path);
+    std::cout << "Total path length = " << total_path_length 
+        << "\n";
+
+    // Calculate the percentage
+    double percentage = static_cast<double>(total_path_length)
+        / static_cast<double>(total_possible_moves);
+
+    std::cout << "Total path length is " << percentage << " percent of max " 
+        << "possible path length\n";
+}
+
 /* Algorithm - Calculate the number of total moves possible if a path traversed
  *             every possible node
  *             - '.' = 1; 'W' = 2; 'L' = 5; Both 'T' = 1; 'R' & 'B' = 0
  *           - Create an int vector with a value for each move
  *           - Sum the vector
- *           - Print the total possible path length and the percentage of the 
- *             total length for m_path
  * 
  */
-void KnightGraph::printCalculatedPathLengthAndPercent()
+int KnightGraph::calcTotalPossibleMoves()
 {
     std::vector<int> move_lengths;
     bool teleport_was_on_board = false;
-    for (unsigned int i = 0; i < m_board.size(); i++)
+    for (int i = 0; i < m_board.getRowCount(); i++)
     {
-        for (unsigned int j = 0; j < m_board_row_size; j++)
+        for (int j = 0; j < m_board_row_size; j++)
         {
-            char node_type = m_board[i][j];
+            char node_type = m_board.getCell(j, i);
 
             // Determine what the move value will be
             switch(node_type)
@@ -841,18 +3369,23 @@ void KnightGraph::printCalculatedPathLengthAndPercent()
     }
 
     // Sum the moves
-    int total_possible_moves = std::accumulate(move_lengths.begin(), 
+    return std::accumulate(move_lengths.begin(), 
         move_lengths.end(), 0);
-    std::cout << "Total possible moves on board = " << total_possible_moves 
-        << "\n";
+}
 
-    // Calculate the length of m_path
+/* Algorithm - Create an int vector with a value for each node in the path
+ *             - '.' = 1; 'W' = 2; 'L' = 5; 'T' = 0
+ *           - Sum the vector
+ * 
+ */
+int KnightGraph::calcPathLength(std::vector<Vertex> &path)
+{
     std::vector<int> path_lengths;
     bool teleport_was_in_path = false;
-    for (unsigned int i = 0; i < m_path.size(); i++)
+    for (unsigned int i = 0; i < path.size(); i++)
     {
         // Get the node tyoe of the legal move node
-        char node_type = m_board[m_path[i].y][m_path[i].x];
+        char node_type = m_board.getCell(path[i].x, path[i].y);
 
         // Determine what the edge weight will be for the adj matrix connection
         switch(node_type)
@@ -886,15 +3419,75 @@ void KnightGraph::printCalculatedPathLengthAndPercent()
     }
 
     // Sum the moves
-    int total_path_length = std::accumulate(path_lengths.begin(), 
+    return std::accumulate(path_lengths.begin(), 
         path_lengths.end(), 0);
-    std::cout << "Total path length = " << total_path_length 
-        << "\n";
+}
 
-    // Calculate the percentage
-    double percentage = static_cast<double>(total_path_length)
-        / static_cast<double>(total_possible_moves);
+/* Algorithm - Unless the graph was constructed over a graph file, mark every
+ *             node that is not a rock or barrier visited and call 
+ *             buildAdjacencyList() to pack the edges of every node, then reset
+ *             the visited status
+ *           - For each hot start node on the board, call daSearch() and copy
+ *             the distance and parent node of every node into a table
+ *           - Copy the legal move mask of every node
+ *           - Call GraphFile::write() to write the board, masks, adjacency 
+ *             list and tables
+ * 
+ */
+bool KnightGraph::saveGraph(const char *file_name, 
+    const std::vector<Vertex> &hot_starts)
+{
+    // Build the adjacency list of every node that can be moved to
+    if (!m_graph_file)
+    {
+        for (int n = 0; n < m_node_count; n++)
+        {
+            char node_type = m_board.getCell(m_nodes[n].x, m_nodes[n].y);
+            m_nodes[n].visited = (node_type != 'R' && node_type != 'B');
+        }
 
-    std::cout << "Total path length is " << percentage << " percent of max " 
-        << "possible path length\n";
+        buildAdjacencyList();
+
+        for (int n = 0; n < m_node_count; n++)
+        {
+            m_nodes[n].visited = false;
+        }
+    }
+
+    // Build a distance table from each hot start node
+    std::vector<int> table_starts;
+    std::vector<std::vector<int> > distances;
+    std::vector<std::vector<int> > parents;
+
+    for (unsigned int i = 0; i < hot_starts.size(); i++)
+    {
+        Vertex start(hot_starts[i].x, hot_starts[i].y, m_board_row_size);
+        if (!m_validator->isOnBoard(start))
+        {
+            continue;
+        }
+
+        setM_nodeValsToDefaults();
+        daSearch(start.number);
+
+        table_starts.push_back(start.number);
+        distances.push_back(std::vector<int>(m_node_count));
+        parents.push_back(std::vector<int>(m_node_count));
+        for (int n = 0; n < m_node_count; n++)
+        {
+            distances.back()[n] = getNode(n).distance;
+            parents.back()[n]   = getNode(n).parent_num;
+        }
+    }
+
+    // Copy the legal move masks
+    std::vector<uint8_t> move_masks(m_node_count);
+    for (int n = 0; n < m_node_count; n++)
+    {
+        move_masks[n] = m_validator->getLegalMoveMask(n);
+    }
+
+    return GraphFile::write(file_name, m_board, &move_masks[0], m_csr_offsets,
+        m_csr_targets, m_csr_weights, m_csr_edge_count, table_starts, 
+        distances, parents);
 }
@@ -3,23 +3,55 @@
 
 /*              Author: Michael Marven
  *        Date Created: 05/30/17
- *  Date Last Modified: 07/02/17
+ *  Date Last Modified: 10/17/26
  *
  */
 
-#include <deque>
 #include <vector>
 #include <iostream>
+#include <random>
+#include <chrono>
+#include <functional>
+#include <atomic>
 
 #include "CommonDefs.h"
 #include "MoveValidator.h"
+#include "IndexedHeap.h"
+#include "BitBoard.h"
+#include "BoardView.h"
+#include "GraphFile.h"
 
 class KnightGraph
 {
 public:
 
-    // Constructor
-    KnightGraph(std::vector<std::vector<char> > board);
+    // Constructors
+    KnightGraph(const std::vector<std::vector<char> > &board);
+
+    /* Brief desc.     - A constructor to build the graph of a board held by the
+     *                   caller, such as a board mapped from a file
+     * param[in] board - View of the board
+     *
+     * Note            - The board is not copied; The viewed buffer must outlive
+     *                   the KnightGraph object
+     *
+     */
+    KnightGraph(const BoardView &board);
+
+    /* Brief desc.          - A constructor to use the board, legal move masks
+     *                        and adjacency list of a graph file
+     * param[in] graph_file - Loaded graph file
+     *
+     * Note                 - Nothing is copied from the file; The GraphFile 
+     *                        object must outlive the KnightGraph object
+     *                      - The adjacency list of a graph file holds every 
+     *                        node, so dfsGraphBuild() does not build it again
+     *                      - daShortestPath() builds the path from the  
+     *                        distance table of the start node if the file has
+     *                        one
+     *
+     */
+    KnightGraph(const GraphFile &graph_file);
 
     // Destructor
     ~KnightGraph();
@@ -44,6 +76,38 @@ public:
      */
     void bfsShortestPath(int start_x, int start_y, int end_x, int end_y);
 
+    /* Brief desc.       - A method to find a shortest path to the end using 
+     *                     a bit-parallel breadth-first search on the BitBoard
+     * Note              - Every move counts as one, so water and lava nodes 
+     *                     are treated as normal nodes; The whole frontier is 
+     *                     expanded 64 nodes per word, and the parents on the 
+     *                     path are recovered from the frontier of each level
+     * param[in] x_start - X coordinate of the starting node
+     * param[in] y_start - Y coordinate of the starting node
+     * param[in] x_end   - X coordinate of the ending node
+     * param[in] y_end   - Y coordinate of the ending node
+     *
+     */
+    void bitBfsShortestPath(int start_x, int start_y, int end_x, int end_y);
+
+    /* Brief desc.      - A method to find the number of moves from each of a 
+     *                    batch of starting nodes to every node, using a 
+     *                    multi-source bit-parallel breadth-first search
+     * Note             - Every move counts as one, as in bitBfsShortestPath();
+     *                    Up to 64 starting nodes share one search, with one bit
+     *                    per starting node in the word of each node, so larger
+     *                    batches are searched 64 starting nodes at a time; The
+     *                    batch shares the most work when its starting nodes 
+     *                    are close together, so their frontiers overlap
+     * param[in] starts - Vector of Vertex for the starting nodes
+     *
+     * param[out]       - Returns one row per starting node, indexed by node 
+     *                    number; Unreachable nodes, and every node for an 
+     *                    invalid starting node, hold INT_MAX
+     *
+     */
+    std::vector<std::vector<int> > msBfsDistances(std::vector<Vertex> starts);
+
     /* Brief desc.       - A method to find a shortest path to the end using 
      *                     Dijkstra's algorithm
      * param[in] x_start - X coordinate of the starting node
@@ -54,8 +118,67 @@ public:
      */
     void daShortestPath(int start_x, int start_y, int end_x, int end_y);
 
+    /* Brief desc.       - A method to find a shortest path to the end using 
+     *                     Dial's algorithm (Dijkstra's algorithm with a 
+     *                     circular bucket queue)
+     * Note              - Returns the same path as daShortestPath() in O(V + E)
+     *                     time, since the edge weights are small integers
+     * param[in] x_start - X coordinate of the starting node
+     * param[in] y_start - Y coordinate of the starting node
+     * param[in] x_end   - X coordinate of the ending node
+     * param[in] y_end   - Y coordinate of the ending node
+     *
+     */
+    void dialShortestPath(int start_x, int start_y, int end_x, int end_y);
+
+    /* Brief desc.       - A method to find a shortest path to the end using 
+     *                     A* search
+     * Note              - The heuristic is the min number of knight moves on an
+     *                     empty board, allowing for the teleport pair, scaled 
+     *                     by the min edge weight; The search stops once the end
+     *                     node is settled
+     * param[in] x_start - X coordinate of the starting node
+     * param[in] y_start - Y coordinate of the starting node
+     * param[in] x_end   - X coordinate of the ending node
+     * param[in] y_end   - Y coordinate of the ending node
+     *
+     */
+    void astarShortestPath(int start_x, int start_y, int end_x, int end_y);
+
+    /* Brief desc.           - A method to find a shortest path to the end using
+     *                         a bidirectional search, forward from the start 
+     *                         node and backward from the end node
+     * Note                  - With use_weights false, every edge counts as one
+     *                         move and the search is a bidirectional BFS
+     * param[in] x_start     - X coordinate of the starting node
+     * param[in] y_start     - Y coordinate of the starting node
+     * param[in] x_end       - X coordinate of the ending node
+     * param[in] y_end       - Y coordinate of the ending node
+     * param[in] use_weights - True to use the water and lava edge weights
+     *
+     */
+    void bidiShortestPath(int start_x, int start_y, int end_x, int end_y, 
+        bool use_weights);
+
+    /* Brief desc.       - A method to find a shortest path to the end using 
+     *                     Dijkstra's algorithm without building the adjacency 
+     *                     list first
+     * Note              - The edges of each node are generated from the legal
+     *                     move masks when the node is settled, and the search 
+     *                     stops once the end node is settled
+     * param[in] x_start - X coordinate of the starting node
+     * param[in] y_start - Y coordinate of the starting node
+     * param[in] x_end   - X coordinate of the ending node
+     * param[in] y_end   - Y coordinate of the ending node
+     *
+     */
+    void lazyShortestPath(int start_x, int start_y, int end_x, int end_y);
+
     /* Brief desc.        - A method to find the approximate longest path to the 
      *                      end node
+     * Note               - The searches stop early once a path visits as many
+     *                      distinct nodes as the reachable nodes and the node
+     *                      colors allow, since no path can visit more
      * param[in] x_start  - X coordinate of the starting node
      * param[in] y_start  - Y coordinate of the starting node
      * param[in] x_end    - X coordinate of the ending node
@@ -66,60 +189,661 @@ public:
     void apprLongestPath(int start_x, int start_y, int end_x, int end_y, 
         int searches);
 
+    /* Brief desc.        - A method to find the approximate longest path to the 
+     *                      end node, running searches until a deadline
+     * Note               - The progress callback, if set, is called with the 
+     *                      calculated length of each new longest path and its 
+     *                      fraction of the max possible path length, as 
+     *                      printCalculatedPathLengthAndPercent() prints them
+     * param[in] x_start  - X coordinate of the starting node
+     * param[in] y_start  - Y coordinate of the starting node
+     * param[in] x_end    - X coordinate of the ending node
+     * param[in] y_end    - Y coordinate of the ending node
+     * param[in] deadline - Time after which no new search is started
+     * param[in] progress - Callback for each new longest path, or nullptr
+     *
+     */
+    void apprLongestPath(int start_x, int start_y, int end_x, int end_y, 
+        std::chrono::steady_clock::time_point deadline, 
+        std::function<void(int, double)> progress);
+
+    /* Brief desc.        - A method to find the approximate longest path to the 
+     *                      end node, running the searches in parallel
+     * Note               - Each thread runs its share of the searches with its 
+     *                      own search state and random number engine, and 
+     *                      keeps its own longest path; The longest of those 
+     *                      paths is placed in m_path
+     * param[in] x_start  - X coordinate of the starting node
+     * param[in] y_start  - Y coordinate of the starting node
+     * param[in] x_end    - X coordinate of the ending node
+     * param[in] y_end    - Y coordinate of the ending node
+     * param[in] searches - The number of searches that should be performed
+     * param[in] threads  - The number of threads to use; 0 uses the number of 
+     *                      hardware threads
+     *
+     */
+    void parApprLongestPath(int start_x, int start_y, int end_x, int end_y, 
+        int searches, int threads);
+
+    /* Brief desc.       - A method to turn dead-end pruning of the longest 
+     *                     path searches on or off; It is off by default
+     * Note              - With pruning on, each step of a search first finds 
+     *                     the unvisited nodes that can still reach the end 
+     *                     node, and only moves to one of them, so the path 
+     *                     never strands the knight in a pocket cut off from 
+     *                     the end node; Each step costs a bit-parallel flood 
+     *                     of the board
+     * param[in] pruning - True to turn pruning on
+     *
+     */
+    void setRolloutPruning(bool pruning);
+
+    /* Brief desc.           - A method to find the longest simple path to the 
+     *                         end node with a branch and bound depth-first 
+     *                         search
+     * Note                  - The path length is weighted like the edges of 
+     *                         daShortestPath(); A branch is cut when the 
+     *                         weights of the unvisited nodes still reachable 
+     *                         from it cannot make a longer path, or the end 
+     *                         node is no longer reachable; Moves to nodes with
+     *                         the fewest onward moves are tried first 
+     *                         (Warnsdorff's rule); Meant for boards of up to 
+     *                         about 64 free nodes
+     * param[in] x_start     - X coordinate of the starting node
+     * param[in] y_start     - Y coordinate of the starting node
+     * param[in] x_end       - X coordinate of the ending node
+     * param[in] y_end       - Y coordinate of the ending node
+     * param[in] node_budget - The most nodes the search may expand
+     *
+     * param[out]            - Returns true if the path in m_path is proven to 
+     *                         be a longest path; false if the node budget ran 
+     *                         out first, in which case m_path holds the longest
+     *                         path found
+     *
+     */
+    bool exactLongestPath(int start_x, int start_y, int end_x, int end_y, 
+        long long node_budget);
+
+    /* Brief desc.        - A method to lengthen the path in m_path with local 
+     *                      search until a deadline, such as after 
+     *                      apprLongestPath()
+     * Note               - Two unvisited nodes are spliced between consecutive 
+     *                      path nodes wherever the moves allow it; When no 
+     *                      splice is left, a segment of the path is reversed 
+     *                      where its ends connect the other way round, which 
+     *                      keeps the length but opens new splices; The start 
+     *                      and end nodes and the moves to and from teleport 
+     *                      nodes stay the same, and a path with repeated nodes
+     *                      is left as it is
+     * param[in] deadline - Time after which no new pass is started
+     *
+     */
+    void improveLongestPath(std::chrono::steady_clock::time_point deadline);
+
     /* Brief desc. - A method to retrieve the path of moves to the end node 
      * param[out]  - Returns vector of Vertex from m_path
      *
      */
     std::vector<Vertex> getPathToEnd();
 
+    /* Brief desc. - A method to retrieve the number of nodes expanded by the 
+     *               last bitBfsShortestPath(), daShortestPath(), 
+     *               dialShortestPath(), astarShortestPath(), 
+     *               bidiShortestPath() or lazyShortestPath() search
+     * param[out]  - Returns the number of nodes that were settled
+     *
+     */
+    int getExpandedNodeCount();
+
     /* Brief desc. - A method to print the length of m_path, calculating extra 
      *               moves for water and lava nodes
      *
      */
     void printCalculatedPathLengthAndPercent();
 
+    /* Brief desc. - A method to calculate the max possible path length of the
+     *               board, counting extra moves for water and lava nodes
+     * param[out]  - Returns the number of moves
+     *
+     */
+    int calcTotalPossibleMoves();
+
+    /* Brief desc.    - A method to calculate the length of a path, counting 
+     *                  extra moves for water and lava nodes
+     * param[in] path - Vector of Vertex for the path
+     *
+     * param[out]     - Returns the number of moves
+     *
+     */
+    int calcPathLength(std::vector<Vertex> &path);
+
+    /* Brief desc.          - A method to write the board, legal move masks and
+     *                        the adjacency list of every node to a graph file,
+     *                        with a shortest path distance table from each hot
+     *                        start node
+     * param[in] file_name  - Name of the graph file
+     * param[in] hot_starts - Vector of Vertex for the start nodes to write 
+     *                        distance tables for; Nodes not on the board are 
+     *                        skipped
+     *
+     * param[out]           - Returns true if the file was written
+     *
+     * Note                 - The adjacency list is left holding every node
+     *
+     */
+    bool saveGraph(const char *file_name, 
+        const std::vector<Vertex> &hot_starts);
+
 private:
 
-    /* Brief desc.       - A recursive method to visit nodes and build the
-     *                     adjacency matrix
+    // Not copyable, as the MoveValidator and BitBoard objects are deleted by 
+    // the destructor and m_board may point into m_board_cells
+    KnightGraph(const KnightGraph &other);
+    KnightGraph &operator=(const KnightGraph &other);
+
+    // Search state of a longest path search, so searches can run in parallel
+    // without sharing m_nodes and m_path
+    struct RolloutState
+    {
+        // Visited status and parent node of each node
+        std::vector<Vertex> nodes;
+
+        // Path of the last search
+        std::vector<Vertex> path;
+
+        // Longest path to the end node found with this state
+        std::vector<Vertex> longest_path;
+
+        // Number of the node after each node on longest_path, or -1 if the 
+        // node is not on it or is its last node
+        std::vector<int> longest_next;
+
+        // Number of unvisited legal move targets of each node
+        std::vector<int> degrees;
+
+        // Sum of the degrees of the unvisited legal move targets of each node
+        std::vector<int> degree_sums;
+
+        // Plane of the unvisited passable nodes, and the planes 
+        // markEndReachableNodes() floods it with; end_reachable marks the 
+        // moves that can still reach the end node
+        std::vector<uint64_t> unvisited;
+
+        std::vector<uint64_t> end_reachable;
+
+        std::vector<uint64_t> frontier;
+
+        std::vector<uint64_t> sources;
+
+        std::vector<uint64_t> targets;
+
+        // Generation of the current search, and the generation that last used
+        // each node; See touchRolloutNode()
+        uint32_t generation;
+
+        std::vector<uint32_t> stamps;
+
+        std::mt19937 engine;
+    };
+
+    // Depth-first search frame of exactLongestPath()
+    struct ExactFrame
+    {
+        // Number of the node and the weighted length of the path to it
+        int number;
+        int distance;
+
+        // Moves to unvisited nodes, in the order they are tried
+        int targets[KNIGHT_MOVE_COUNT];
+        int weights[KNIGHT_MOVE_COUNT];
+        int edge_count;
+
+        // Index of the next move to try
+        int next_edge;
+    };
+
+    // Number of words of m_path_used up to which exactLongestPath() keeps 
+    // the states it searched to the end, and the number of entries kept
+    static const int EXACT_MEMO_WORDS = 2;
+
+    static const int EXACT_MEMO_SIZE = 1 << 18;
+
+    // Search state of exactLongestPath() that was searched to the end, kept so
+    // the state is not searched again
+    struct ExactMemoEntry
+    {
+        // Nodes on the path and the node at its end, or -1 if the entry is 
+        // empty
+        uint64_t used[EXACT_MEMO_WORDS];
+        int      number;
+
+        // Longest weighted length of a path to the node that the state was 
+        // searched to the end with
+        int distance;
+    };
+
+    /* Brief desc.       - A method to visit the nodes reachable from the 
+     *                     starting node with an iterative DFS
      * param[in] start_x - X coordinate of the starting node
      * param[in] start_y - Y coordinate of the starting node
      *
      */
     void dfsVisitNext(int start_x, int start_y);
 
-    /* Brief desc.        - A method to retrieve the neighbor(s) with the least
-     *                      degree (number of nodes connected)
-     * param[in] position - Vertex representing the start position
+    /* Brief desc. - A method to pack the edges of all visited nodes into the 
+     *               compressed sparse row (CSR) adjacency list
+     * Note        - The edges of node n are stored in m_adj_targets and 
+     *               m_adj_weights from index m_adj_offsets[n] up to, but not 
+     *               including, index m_adj_offsets[n + 1], sorted by target 
+     *               node number
+     *
+     */
+    void buildAdjacencyList();
+
+    /* Brief desc. - A method to build the reverse of the adjacency list, so 
+     *               the edges into node n are stored in m_rev_adj_sources and 
+     *               m_rev_adj_weights from index m_rev_adj_offsets[n] up to, but
+     *               not including, index m_rev_adj_offsets[n + 1]
+     *
+     */
+    void buildReverseAdjacencyList();
+
+    /* Brief desc. - A method to point m_csr_offsets, m_csr_targets and 
+     *               m_csr_weights to the adjacency list of the graph file, or
+     *               to m_adj_offsets, m_adj_targets and m_adj_weights
+     *
+     */
+    void setAdjacencyData();
+
+    /* Brief desc.            - A method to find the shortest path distance and
+     *                          parent node of every node reachable from a start
+     *                          node with Dijkstra's algorithm
+     * param[in] start_number - Number of the start node
+     *
+     * Note                   - The distances and parent nodes are left in 
+     *                          m_nodes for the current generation
+     *
+     */
+    void daSearch(int start_number);
+
+    /* Brief desc.        - A method to generate the edges of a node from its
+     *                      legal move mask
+     * param[in] number   - Number of the node
+     * param[out] targets - Array of at least KNIGHT_MOVE_COUNT ints to receive
+     *                      the target node numbers, sorted
+     * param[out] weights - Array of at least KNIGHT_MOVE_COUNT ints to receive
+     *                      the edge weights
+     *
+     * param[out]         - Returns the number of edges
+     *
+     */
+    int getNodeEdges(int number, int *targets, int *weights);
+
+    /* Brief desc.            - A method to run one longest path search, 
+     *                          building a path with the least degree heuristic
+     *                          from the start node until the end node is 
+     *                          reached or no unvisited moves remain
+     * param[in] start        - Vertex representing the start position
+     * param[in] end          - Vertex representing the end position
+     * param[in] state        - Search state; The search avoids following 
+     *                          state.longest_path, and the path is placed in 
+     *                          state.path
+     *
+     */
+    void runRollout(Vertex start, Vertex end, RolloutState &state);
+
+    /* Brief desc.     - A method to verify the start and end nodes of a 
+     *                   longest path search and place the shortest path in 
+     *                   m_best_path
+     * param[in] start - Vertex representing the start position
+     * param[in] end   - Vertex representing the end position
+     *
+     * param[out]      - Returns false if the start or end node is invalid
+     *
+     */
+    bool prepareLongestPath(Vertex start, Vertex end);
+
+    /* Brief desc.     - A method to prepare a search state for the board
+     * param[in] state - Search state
+     *
+     */
+    void initRolloutState(RolloutState &state);
+
+    /* Brief desc.     - A method to set the longest path of a search state and
+     *                   index the node after each node on it
+     * param[in] path  - Vector of Vertex for the path
+     * param[in] state - Search state
+     *
+     */
+    void setRolloutLongestPath(std::vector<Vertex> &path, RolloutState &state);
+
+    /* Brief desc.    - A method to check whether a path visits as many 
+     *                  distinct nodes as m_path_node_bound
+     * Note           - A path can land on the teleport nodes more than once,
+     *                  so its size can overstate the nodes it visits
+     * param[in] path - Vector of Vertex for the path
+     *
+     * param[out]     - Returns true if no path can visit more nodes
+     *
+     */
+    bool reachesPathNodeBound(const std::vector<Vertex> &path) const;
+
+    /* Brief desc.      - A method to reset the visited status, parent node, 
+     *                    degree and degree sum of a node in a search state if
+     *                    an earlier generation of the state last used it
+     * param[in] number - Number of the node
+     * param[in] state  - Search state
+     *
+     */
+    void touchRolloutNode(int number, RolloutState &state);
+
+    /* Brief desc.        - A method to run a number of longest path searches on
+     *                      one search state, keeping the longest path to the 
+     *                      end node in state.longest_path
+     * param[in] start    - Vertex representing the start position
+     * param[in] end      - Vertex representing the end position
+     * param[in] searches - The number of searches that should be performed
+     * param[in] state    - Search state of the thread
+     *
+     */
+    void runRolloutWorker(Vertex start, Vertex end, int searches, 
+        RolloutState &state);
+
+    /* Brief desc.           - A method to retrieve the neighbor(s) with the 
+     *                         least degree (number of nodes connected)
+     * param[in] number      - Number of the node
+     * param[in] state       - Search state holding the visited status and the
+     *                         degrees; With pruning on, only the neighbors in 
+     *                         state.end_reachable are considered
+     * param[out] neighbors  - Array of at least KNIGHT_MOVE_COUNT ints to 
+     *                         receive the numbers of the neighbors with the 
+     *                         least degree
+     *
+     * param[out]            - Returns the number of neighbors
+     *
+     */
+    int getLeastDegreeNeighbors(int number, RolloutState &state, 
+        int *neighbors);
+
+    /* Brief desc.      - A method to mark a node visited in a search state and
+     *                    update the degrees and degree sums it changes
+     * param[in] number - Number of the node
+     * param[in] state  - Search state
+     *
+     */
+    void visitRolloutNode(int number, RolloutState &state);
+
+    /* Brief desc.          - A method to find which unvisited legal move 
+     *                        targets of a node can reach the end node through
+     *                        unvisited nodes, and mark them in 
+     *                        state.end_reachable
+     * Note                 - Other nodes may be marked too; Only the bits of 
+     *                        the targets are meaningful
+     * param[in] number     - Number of the node
+     * param[in] end_number - Number of the end node
+     * param[in] state      - Search state
+     *
+     */
+    void markEndReachableNodes(int number, int end_number, 
+        RolloutState &state);
+
+    /* Brief desc.        - A method to set up the search frame of a node in 
+     *                      exactLongestPath(), keeping the moves to nodes not
+     *                      on the path and ordering them by Warnsdorff's rule
+     * param[in] number   - Number of the node
+     * param[in] distance - Weighted length of the path to the node
+     * param[out] frame   - Search frame
+     *
+     */
+    void initExactFrame(int number, int distance, ExactFrame &frame);
+
+    /* Brief desc.      - A method to add a node to, or remove it from, the 
+     *                    path of exactLongestPath() in m_path_used
+     * Note             - Both teleport nodes are marked together, since a 
+     *                    path through one uses the other
+     * param[in] number - Number of the node
+     * param[in] used   - True to add the node, false to remove it
+     *
+     */
+    void markExactNode(int number, bool used);
+
+    /* Brief desc.        - A method to check whether the path in m_path_used,
+     *                      ending at a node, was searched to the end before by
+     *                      exactLongestPath() with at least the same length
+     * param[in] number   - Number of the node at the end of the path
+     * param[in] distance - Weighted length of the path
+     *
+     * param[out]         - Returns true if searching the path again cannot 
+     *                      find a longer path
+     *
+     */
+    bool isExactStateSearched(int number, int distance);
+
+    /* Brief desc.        - A method to keep the path in m_path_used, ending at
+     *                      a node, as searched to the end by exactLongestPath()
+     * param[in] number   - Number of the node at the end of the path
+     * param[in] distance - Weighted length of the path
+     *
+     */
+    void keepExactState(int number, int distance);
+
+    /* Brief desc.      - A method to find the entry of m_exact_memo for the 
+     *                    path in m_path_used ending at a node
+     * param[in] number - Number of the node at the end of the path
+     *
+     * param[out]       - Returns a reference to the entry
+     *
+     */
+    ExactMemoEntry &getExactMemoEntry(int number);
+
+    /* Brief desc.    - A method to check if the knight can move directly 
+     *                  from one node to another
+     * param[in] from - Number of the starting node
+     * param[in] to   - Number of the target node
+     *
+     * param[out]     - Returns true if the move is legal
+     *
+     */
+    bool isLegalMove(int from, int to);
+
+    /* Brief desc.      - A method to check if a node is one of the teleport 
+     *                    pair
+     * param[in] number - Number of the node
      *
-     * param[out]         - Returns vector of Vertex of neighbors with the least
-     *                      degree
+     * param[out]       - Returns true if the node is a teleport node
      *
      */
-    std::vector<Vertex> getLeastDegreeNeighbors(Vertex start);
+    bool isTeleportNode(int number);
 
-    /* Brief desc.        - A method to retrieve the sum of the degrees of the 
-     *                      neighbor(s) of the node
-     * param[in] position - Vertex representing the start position
+    /* Brief desc.       - A method to splice pairs of unvisited nodes between
+     *                     consecutive nodes of a path in one pass
+     * param[in] path    - Node numbers of the path
+     * param[in] on_path - Plane of the nodes on the path; The spliced nodes
+     *                     are added to it
      *
-     * param[out]         - Returns an int for the sum of the degrees
+     * param[out]        - Returns the number of nodes added
      *
      */
-    int getSumOfDegreesOfNeighbors(Vertex start);
+    int insertPathDetours(std::vector<int> &path, 
+        std::vector<uint64_t> &on_path);
+
+    /* Brief desc.         - A method to reverse a randomly chosen segment of
+     *                       a path whose ends connect the other way round
+     * param[in] path      - Node numbers of the path
+     * param[in] positions - Position of each node on the path, or -1; The 
+     *                       positions of the reversed nodes are updated
+     * param[in] engine    - Random number engine
+     *
+     * param[out]          - Returns false if no segment could be reversed
+     *
+     */
+    bool reversePathSegment(std::vector<int> &path, 
+        std::vector<int> &positions, std::mt19937 &engine);
+
+    /* Brief desc.        - A method to start the path in m_path_used at the 
+     *                      start node and bound its length
+     * param[in] start    - Vertex representing the start position
+     * param[in] end      - Vertex representing the end position
+     * param[in] weighted - True to bound the weighted length, false to bound 
+     *                      the number of moves
+     *
+     * param[out]         - Returns the bound of getReachableWeightBound()
+     *
+     */
+    int getStartBound(Vertex start, Vertex end, bool weighted);
+
+    /* Brief desc.          - A method to bound the weighted length a path can
+     *                        still add from a node without reusing a node in 
+     *                        m_path_used
+     * Note                 - The knight graph alternates node colors, which
+     *                        limits how many nodes of each color the path can
+     *                        land on; A move onto a teleport node of the other
+     *                        color than its pair keeps the color, once
+     *                      - The weighted bound is for the simple paths of 
+     *                        exactLongestPath(), so it also leaves out the 
+     *                        nodes removeDeadEndNodes() finds; The unweighted
+     *                        bound counts the nodes a rollout can visit, and a
+     *                        rollout can land on the teleport pair more than 
+     *                        once, so it only uses the colors without a 
+     *                        teleport pair
+     * param[in] number     - Number of the node
+     * param[in] end_number - Number of the end node
+     * param[in] weighted   - True to weight the nodes like the edges of 
+     *                        daShortestPath(), false to count every node as 1
+     *
+     * param[out]           - Returns the bound, or -1 if the end node is not 
+     *                        reachable
+     *
+     */
+    int getReachableWeightBound(int number, int end_number, bool weighted);
+
+    /* Brief desc.          - A method to bound the weighted length of the 
+     *                        nodes a path can land on, given how many nodes of 
+     *                        each color and weight it can reach
+     * param[in] counts     - Number of reached nodes of each color and weight;
+     *                        Color 0 is the color of the node the path is on
+     * param[in] weights    - Weight of each weight class, lightest first
+     * param[in] same_color - True if the end node has the color of the node 
+     *                        the path is on
+     * param[in] extra      - Color of a teleport node, not in the counts, that
+     *                        the path lands on without changing color, or -1
+     *
+     * param[out]           - Returns the bound, or 0 if the counted nodes leave
+     *                        no path to the end node
+     *
+     */
+    int getColorBound(const int counts[2][3], const int weights[3], 
+        bool same_color, int extra);
+
+    /* Brief desc.          - A method to remove the nodes a path from a node 
+     *                        cannot pass through from m_bound_seen
+     * Note                 - A node other than the end node needs a move onto
+     *                        it from a reached node or the node the path is on,
+     *                        and a move off it to a different reached node
+     * param[in] number     - Number of the node the path is on
+     * param[in] end_number - Number of the end node
+     *
+     */
+    void removeDeadEndNodes(int number, int end_number);
+
+    /* Brief desc. - A method to build the nodes, the MoveValidator and BitBoard
+     *               objects and the degree tables of the board; Called by the
+     *               constructors once m_board is set
+     *
+     */
+    void initGraph();
+
+    /* Brief desc. - A method to build the reverse legal move masks and the 
+     *               degrees and degree sums of a board with no visited nodes
+     *
+     */
+    void buildDegreeTables();
+
+    /* Brief desc.      - A method to check if a node is in the frontier of a
+     *                    level stored by bitBfsShortestPath()
+     * param[in] level  - Level of the frontier
+     * param[in] number - Number of the node
+     *
+     * param[out]       - Returns true if the node is in the frontier
+     *
+     */
+    bool levelContains(int level, int number);
+
+    /* Brief desc.         - A method to retrieve the target of a knight move
+     * param[in] number    - Number of the starting node
+     * param[in] direction - Direction of the move (see KNIGHT_MOVE_X and 
+     *                       KNIGHT_MOVE_Y)
+     *
+     * param[out]          - Returns the number of the target node
+     *
+     * Note                - The move is not checked; Use the legal move mask
+     *                       of the starting node
+     *
+     */
+    int getMoveTarget(int number, int direction);
+
+    /* Brief desc.         - A method to retrieve the node a knight lands on 
+     *                       after a move, following the teleport pair
+     * param[in] number    - Number of the starting node
+     * param[in] direction - Direction of the move (see KNIGHT_MOVE_X and 
+     *                       KNIGHT_MOVE_Y)
+     *
+     * param[out]          - Returns the number of the landing node
+     *
+     * Note                - The move is not checked; Use the legal move mask
+     *                       of the starting node
+     *
+     */
+    int getLandingNode(int number, int direction);
+
+    /* Brief desc.     - A method to verify the start and end nodes are on the
+     *                   board and are not rocks or barriers
+     * param[in] start - Vertex representing the start position
+     * param[in] end   - Vertex representing the end position
+     *
+     * param[out]      - Returns true if both nodes are valid
+     *
+     */
+    bool startAndEndAreValid(Vertex start, Vertex end);
+
+    /* Brief desc.    - A method to retrieve the min number of knight moves 
+     *                  between two nodes on an empty, unbounded board
+     * param[in] from - Number of the first node
+     * param[in] to   - Number of the second node
+     *
+     * param[out]     - Returns the number of moves
+     *
+     */
+    int getKnightDistance(int from, int to);
+
+    /* Brief desc.          - A method to retrieve the A* heuristic for a node
+     * param[in] number     - Number of the node
+     * param[in] end_number - Number of the end node
+     * param[in] min_weight - Min edge weight of the adjacency list
+     *
+     * param[out]           - Returns a lower bound on the distance from the 
+     *                        node to the end node
+     *
+     */
+    int getDistanceEstimate(int number, int end_number, int min_weight);
 
     /* Brief desc. - For all m_nodes, set distance, parent node, and visited to 
      *               default values
+     * Note        - The reset is O(1): It starts a new generation, and each node
+     *               is reset by getNode() the first time the generation uses it
      *
      */
     void setM_nodeValsToDefaults();
 
-    /* Brief desc.   - Returns the longest path from the m_path_store
-     * param[in] end - Vertex representing the end position
+    /* Brief desc.      - A method to retrieve a node of m_nodes for the current
+     *                    search, resetting it first if an earlier generation 
+     *                    last used it
+     * param[in] number - Number of the node
      *
-     * param[out]    - Returns an vector of Vertex
+     * param[out]       - Returns a reference to the node
      *
      */
-    std::vector<Vertex> getLongestPathFromPathStore(Vertex end);
+    Vertex &getNode(int number);
 
     /* Brief desc.     - Build the path in reverse order from the path end node 
      *                   and store in m_path
@@ -129,24 +853,129 @@ private:
      */
     void buildPathInReverse(Vertex start, Vertex end);
 
+    /* Brief desc.     - Build the path in reverse order from the path end node 
+     *                   using the parent nodes of a vector of nodes
+     * param[in] start - Vertex representing the start position
+     * param[in] end   - Vertex representing the end position
+     * param[in] nodes - Vector of Vertex holding the parent nodes
+     * param[out] path - Vector of Vertex to receive the path
+     *
+     */
+    void buildPathInReverse(Vertex start, Vertex end, 
+        std::vector<Vertex> &nodes, std::vector<Vertex> &path);
+
     // Attributes
     MoveValidator *m_validator;
+
+    BitBoard *m_bitboard;
     
-    std::vector<std::vector<char> > m_board;
+    // Board buffer when constructed from rows; Empty when the board is held 
+    // by the caller
+    std::vector<char> m_board_cells;
+
+    // Board shared with the MoveValidator and BitBoard objects
+    BoardView m_board;
 
     std::vector<Vertex> m_nodes;
 
     std::vector<Vertex> m_path;
 
-    std::deque<Vertex> m_node_queue;
+    IndexedHeap m_node_heap;
+
+    IndexedHeap m_rev_node_heap;
 
     int m_board_row_size;
 
     int m_node_count;
 
-    std::vector<std::vector<int> > m_adj_matrix;
+    // Numbers of the teleport nodes, or -1 if the board has no teleport pair
+    int m_teleport_one;
+
+    int m_teleport_two;
+
+    // Number of nodes settled by the last shortest path search
+    int m_expanded_count;
+
+    // Generation of the current search, and the generation that last used 
+    // each node; See getNode()
+    uint32_t m_generation;
+
+    std::vector<uint32_t> m_node_stamps;
+
+    // Bit d of the reverse legal move mask of node n is set if the node that 
+    // is in the opposite direction of direction d from node n has a legal 
+    // move in direction d onto node n
+    std::vector<uint8_t> m_rev_move_masks;
+
+    // Degrees and degree sums with no visited nodes; See RolloutState
+    std::vector<int> m_base_degrees;
+
+    std::vector<int> m_base_degree_sums;
+
+    // Graph file the graph was constructed over, or NULL
+    const GraphFile *m_graph_file;
+
+    // Compressed sparse row adjacency list; See buildAdjacencyList()
+    std::vector<int> m_adj_offsets;
+
+    std::vector<int> m_adj_targets;
+
+    std::vector<int> m_adj_weights;
+
+    // Adjacency list the searches read; See setAdjacencyData()
+    const int *m_csr_offsets;
+
+    const int *m_csr_targets;
+
+    const int *m_csr_weights;
+
+    int m_csr_edge_count;
+
+    // Reverse adjacency list; See buildReverseAdjacencyList()
+    std::vector<int> m_rev_adj_offsets;
+
+    std::vector<int> m_rev_adj_sources;
+
+    std::vector<int> m_rev_adj_weights;
+
+    // Nonzero frontier words of each level of bitBfsShortestPath(); The words
+    // of level k are stored from index m_level_offsets[k] up to, but not 
+    // including, index m_level_offsets[k + 1]
+    std::vector<int> m_level_offsets;
+
+    std::vector<int> m_level_word_indices;
+
+    std::vector<uint64_t> m_level_words;
+
+    // Longest path to the end node found by the last longest path search
+    std::vector<Vertex> m_best_path;
+
+    // Nodes on the path of exactLongestPath(), and the planes 
+    // getReachableWeightBound() floods them with
+    std::vector<uint64_t> m_path_used;
+
+    std::vector<uint64_t> m_bound_free;
+
+    std::vector<uint64_t> m_bound_frontier;
+
+    std::vector<uint64_t> m_bound_reachable;
+
+    std::vector<uint64_t> m_bound_seen;
+
+    // States exactLongestPath() searched to the end, one entry per hash of the
+    // state; Empty unless m_path_used has at most EXACT_MEMO_WORDS words
+    std::vector<ExactMemoEntry> m_exact_memo;
+
+    // Most distinct nodes a path from the start node to the end node of the 
+    // last longest path search can visit, and whether a path visiting that 
+    // many has been found, so the searches can stop
+    int m_path_node_bound;
+
+    std::atomic<bool> m_bound_reached;
 
-    std::vector<std::vector<Vertex> > m_path_store;
+    // True if the longest path searches skip moves that cannot reach the end
+    // node; See setRolloutPruning()
+    bool m_rollout_pruning;
 };
 
 #endif // KNIGHT_GRAPH_H
@@ -1,6 +1,6 @@
 /*              Author: Michael Marven
  *        Date Created: 05/26/17
- *  Date Last Modified: 07/01/17
+ *  Date Last Modified: 10/17/26
  *
  */
 
@@ -10,35 +10,41 @@
 
 #include "MoveValidator.h"
 
-MoveValidator::MoveValidator(std::vector<std::vector<char> > board)
+MoveValidator::MoveValidator(const std::vector<std::vector<char> > &board)
+    : m_board(BoardView::fromRows(board, m_board_cells)),
+    m_board_row_size(m_board.getRowSize()),
+    m_teleport_node_one(NULL),
+    m_teleport_node_two(NULL),
+    m_move_mask_data(NULL)
+{
+    findTeleportNodes();
+
+    // Compute the legal move mask of every node
+    buildMoveMasks();
+}
+
+MoveValidator::MoveValidator(const BoardView &board)
     : m_board(board),
-    m_board_row_size(m_board[0].size())
+    m_board_row_size(m_board.getRowSize()),
+    m_teleport_node_one(NULL),
+    m_teleport_node_two(NULL),
+    m_move_mask_data(NULL)
 {
-    // Find first teleport node
-    for (unsigned int i = 0; i < m_board.size(); i++)
-    {
-        for (unsigned int j = 0; j < m_board[0].size(); j++)
-        {
-            if (m_board[i][j] == 'T')
-            {
-                m_teleport_node_one = new Vertex(j, i, m_board_row_size);
-            }
-        }
-    }
+    findTeleportNodes();
 
-    // Find second teleport node
-    for (unsigned int i = 0; i < m_board.size(); i++)
-    {
-        for (unsigned int j = 0; j < m_board[0].size(); j++)
-        {
-            if (m_board[i][j] == 'T' 
-                && (static_cast<int>(i) != m_teleport_node_one->y 
-                    || static_cast<int>(j) != m_teleport_node_one->x))
-            {
-                m_teleport_node_two = new Vertex(j, i, m_board_row_size);
-            }
-        }
-    }
+    // Compute the legal move mask of every node
+    buildMoveMasks();
+}
+
+MoveValidator::MoveValidator(const BoardView &board, 
+    const uint8_t *move_masks)
+    : m_board(board),
+    m_board_row_size(m_board.getRowSize()),
+    m_teleport_node_one(NULL),
+    m_teleport_node_two(NULL),
+    m_move_mask_data(move_masks)
+{
+    findTeleportNodes();
 }
 
 MoveValidator::~MoveValidator()
@@ -46,7 +52,9 @@ MoveValidator::~MoveValidator()
     // Empty
 }
 
-/* Algorithm - Check the starting and ending points of the move set and set them
+/* Algorithm - If printing, copy the board to m_marked_cells the first time; The
+ *             moves are marked on the copy so the shared board is not changed
+ *           - Check the starting and ending points of the move set and set them
  *             to S and E on the board
  *           - Print the board if necessary
  *           - Loop through moves: 
@@ -58,16 +66,25 @@ MoveValidator::~MoveValidator()
  */
 bool MoveValidator::validateMoves(std::vector<Vertex> moves, bool print_moves)
 {
+    // Copy the board to be marked the first time moves are printed
+    if (print_moves && m_marked_cells.empty())
+    {
+        m_board.copyCells(m_marked_cells);
+    }
+
+    BoardView marked_board(m_marked_cells.empty() ? NULL : &m_marked_cells[0],
+        m_board_row_size, m_board.getRowCount(), m_board_row_size);
+
     // Retrieve starting and ending points and set them to 'S' and 'E'
     if (!moves.empty())
     {
         if (print_moves && isOnBoard(moves.front()))
         {
-            m_board[moves.front().y][moves.front().x] = 'S';
+            m_marked_cells[moves.front().number] = 'S';
         }
         if (print_moves && isOnBoard(moves.back()))
         {
-            m_board[moves.back().y][moves.back().x]   = 'E';
+            m_marked_cells[moves.back().number]  = 'E';
         }
         
     }
@@ -79,7 +96,7 @@ bool MoveValidator::validateMoves(std::vector<Vertex> moves, bool print_moves)
     
     if (print_moves)
     {
-        printBoard(m_board);
+        printBoard(marked_board);
     }
 
     bool all_moves_are_valid = true;
@@ -90,13 +107,13 @@ bool MoveValidator::validateMoves(std::vector<Vertex> moves, bool print_moves)
         // Set current knight position to 'K' on board
         if (print_moves && isOnBoard(moves[i]))
         {
-            m_board[moves[i].y][moves[i].x] = 'K';
+            m_marked_cells[moves[i].number] = 'K';
         }
 
         // Print board if necessary
         if (print_moves)
         {
-            printBoard(m_board);
+            printBoard(marked_board);
         }
 
         // If a move is present, check if it is valid 
@@ -130,71 +147,40 @@ bool MoveValidator::validateMoves(std::vector<Vertex> moves, bool print_moves)
 }
 
 /* Algorithm - Create a set of legal moves starting with 1 o'clock position, 
- *             followed by 2:00, 4:00, 5:00, 7:00, 8:00, 10:00, 11:00
+ *             followed by 2:00, 4:00, 5:00, 7:00, 8:00, 10:00, 11:00, using the
+ *             legal move mask of the start position
  * 
  */
- std::vector<Vertex> MoveValidator::getLegalMoves(Vertex start)
- {
+std::vector<Vertex> MoveValidator::getLegalMoves(Vertex start)
+{
     std::vector<Vertex> legal_moves;
 
-    // Check if move to 1 o'clock position is legal
-    Vertex move(start.x + 1, start.y - 2, m_board_row_size);
-    if (isLegalMove(start, move))
+    if (!isOnBoard(start))
     {
-        legal_moves.push_back(move);
+        return legal_moves;
     }
 
-    // Check if move to 2 o'clock position is legal
-    move = Vertex(start.x + 2, start.y - 1, m_board_row_size);
-    if (isLegalMove(start, move))
-    {
-        legal_moves.push_back(move);
-    }
+    uint8_t mask = m_move_mask_data[start.number];
 
-    // Check if move to 4 o'clock position is legal
-    move = Vertex(start.x + 2, start.y + 1, m_board_row_size);
-    if (isLegalMove(start, move))
+    for (int d = 0; d < KNIGHT_MOVE_COUNT; d++)
     {
-        legal_moves.push_back(move);
-    }
-
-    // Check if move to 5 o'clock position is legal
-    move = Vertex(start.x + 1, start.y + 2, m_board_row_size);
-    if (isLegalMove(start, move))
-    {
-        legal_moves.push_back(move);
-    }
-
-    // Check if move to 7 o'clock position is legal
-    move = Vertex(start.x - 1, start.y + 2, m_board_row_size);
-    if (isLegalMove(start, move))
-    {
-        legal_moves.push_back(move);
-    }
-
-    // Check if move to 8 o'clock position is legal
-    move = Vertex(start.x - 2, start.y + 1, m_board_row_size);
-    if (isLegalMove(start, move))
-    {
-        legal_moves.push_back(move);
-    }
-
-    // Check if move to 10 o'clock position is legal
-    move = Vertex(start.x - 2, start.y - 1, m_board_row_size);
-    if (isLegalMove(start, move))
-    {
-        legal_moves.push_back(move);
-    }
-
-    // Check if move to 10 o'clock position is legal
-    move = Vertex(start.x - 1, start.y - 2, m_board_row_size);
-    if (isLegalMove(start, move))
-    {
-        legal_moves.push_back(move);
+        if (mask & (1 << d))
+        {
+            legal_moves.push_back(Vertex(start.x + KNIGHT_MOVE_X[d], 
+                start.y + KNIGHT_MOVE_Y[d], m_board_row_size));
+        }
     }
 
     return legal_moves;
- }
+}
+
+/* Algorithm - Return the legal move mask of the node
+ * 
+ */
+uint8_t MoveValidator::getLegalMoveMask(int number)
+{
+    return m_move_mask_data[number];
+}
 
 /* Algorithm - Check if position is valid; Position is valid if it is located 
  *             on the board
@@ -205,8 +191,8 @@ bool MoveValidator::isOnBoard(Vertex position)
     // std::cout << "MoveValidator::isOnBoard - Entered\n";
     bool position_is_on_board  = true;
 
-    if ((position.x < 0 || position.x >= static_cast<int>(m_board[0].size()))
-        || (position.y < 0 || position.y >= static_cast<int>(m_board.size())))
+    if ((position.x < 0 || position.x >= m_board_row_size)
+        || (position.y < 0 || position.y >= m_board.getRowCount()))
     {
         position_is_on_board = false;
     }
@@ -222,7 +208,7 @@ bool MoveValidator::isRock(Vertex position)
     bool position_is_rock = false;
 
     // Check if position is a rock
-    if (isOnBoard(position) && m_board[position.y][position.x] == 'R')
+    if (isOnBoard(position) && m_board.getCell(position.x, position.y) == 'R')
     {
         position_is_rock = true;
     }
@@ -238,7 +224,7 @@ bool MoveValidator::isBarrier(Vertex position)
     bool position_is_barrier = false;
 
     // Check if position is a barrier
-    if (isOnBoard(position) && m_board[position.y][position.x] == 'B')
+    if (isOnBoard(position) && m_board.getCell(position.x, position.y) == 'B')
     {
         position_is_barrier = true;
     }
@@ -251,7 +237,7 @@ bool MoveValidator::isBarrier(Vertex position)
  */
 Vertex MoveValidator::getTeleportNode(Vertex position)
 {
-    if (isOnBoard(position))
+    if (isOnBoard(position) && m_teleport_node_one && m_teleport_node_two)
     {
         if (isOnBoard(position) && position.number == m_teleport_node_one->number)
         {
@@ -274,14 +260,14 @@ Vertex MoveValidator::getTeleportNode(Vertex position)
 /* Algorithm - Loop through each row and print each character
  * 
  */
-void MoveValidator::printBoard(std::vector<std::vector<char> > board)
+void MoveValidator::printBoard(const BoardView &board)
 {
     // Loop through board and print each character
-    for (unsigned int i = 0; i < board.size(); i++)
+    for (int i = 0; i < board.getRowCount(); i++)
     {
-        for (unsigned int j = 0; j < board[i].size(); j++)
+        for (int j = 0; j < board.getRowSize(); j++)
         {
-            std::cout << board[i][j] << " ";
+            std::cout << board.getCell(j, i) << " ";
         }
 
         std::cout << "\n";
@@ -290,25 +276,90 @@ void MoveValidator::printBoard(std::vector<std::vector<char> > board)
     std::cout << "\n";
 }
 
+/* Algorithm - Loop through the board and record the last teleport node found
+ *           - Loop through the board again and record the last teleport node 
+ *             that is not the first one
+ * 
+ */
+void MoveValidator::findTeleportNodes()
+{
+    // Find first teleport node
+    for (int i = 0; i < m_board.getRowCount(); i++)
+    {
+        for (int j = 0; j < m_board_row_size; j++)
+        {
+            if (m_board.getCell(j, i) == 'T')
+            {
+                m_teleport_node_one = new Vertex(j, i, m_board_row_size);
+            }
+        }
+    }
+
+    // Find second teleport node
+    for (int i = 0; m_teleport_node_one && i < m_board.getRowCount(); i++)
+    {
+        for (int j = 0; j < m_board_row_size; j++)
+        {
+            if (m_board.getCell(j, i) == 'T' 
+                && (i != m_teleport_node_one->y || j != m_teleport_node_one->x))
+            {
+                m_teleport_node_two = new Vertex(j, i, m_board_row_size);
+            }
+        }
+    }
+}
+
+/* Algorithm - Loop through each position on the board and check the move in
+ *             each knight direction with checkMove(); Set bit i of the mask if
+ *             the move in direction i is valid
+ *           - Point m_move_mask_data to the masks
+ * 
+ */
+void MoveValidator::buildMoveMasks()
+{
+    m_move_masks.assign(m_board.getRowCount() * m_board_row_size, 0);
+
+    for (int i = 0; i < m_board.getRowCount(); i++)
+    {
+        for (int j = 0; j < m_board_row_size; j++)
+        {
+            Vertex origin(j, i, m_board_row_size);
+            uint8_t mask = 0;
+
+            for (int d = 0; d < KNIGHT_MOVE_COUNT; d++)
+            {
+                Vertex destination(j + KNIGHT_MOVE_X[d], i + KNIGHT_MOVE_Y[d], 
+                    m_board_row_size);
+
+                if (checkMove(origin, destination))
+                {
+                    mask |= (1 << d);
+                }
+            }
+
+            m_move_masks[origin.number] = mask;
+        }
+    }
+
+    m_move_mask_data = &m_move_masks[0];
+}
+
 /* Algorithm - Check if move is valid; Move is valid if the knight moves in an
  *             L shape - horizontal 2 spaces, then vertical 1 space, or vertical 
- *             2 spaces, then horizontal 1 space; The destination must not be 
- *             located beyond the edge of the board; The destination must not be
- *             a rock; The destination must not be a barrier and a barrier must
- *             not lie within the path of the move
+ *             2 spaces, then horizontal 1 space; The origin and destination 
+ *             must not be located beyond the edge of the board; The 
+ *             destination must not be a rock; The destination must not be a 
+ *             barrier and a barrier must not lie within the path of the move
  *
  * Note      - If the destination is a teleport node, the origin must be a
  *             teleport node; If both are teleport nodes, the move is valid
  * 
  */
-bool MoveValidator::checkMove(Vertex origin, Vertex destination)
+bool MoveValidator::checkMove(const Vertex &origin, 
+    const Vertex &destination)
 {
     // Check if move is valid
     bool is_valid_shape  = false;
-    bool dest_on_board   = false;
-    bool dest_is_rock    = false;
-    bool dest_is_barrier = false;
-    bool dest_is_blocked = false;
     bool tests_passed    = false;
 
     // Check if move is proper L shape
@@ -333,36 +384,28 @@ bool MoveValidator::checkMove(Vertex origin, Vertex destination)
         is_valid_shape = true;
     }
 
-    // Check if destination is beyond the edge of the board
-    if (isOnBoard(destination))
-    {
-        dest_on_board = true;
-    }
-
-    // Check if destination is a rock
-    if (dest_on_board && isRock(destination))
-    {
-        dest_is_rock = true;
-    }
+    // Check if origin or destination is beyond the edge of the board; An 
+    // origin off the board has no node type and no path to check
+    bool dest_on_board = isOnBoard(origin) && isOnBoard(destination);
 
-    // Check if destination is a barrier
-    if (dest_on_board && isBarrier(destination))
-    {
-        dest_is_barrier = true;
-    }
+    // Check if destination is a rock or a barrier; The node type is read once
+    // the destination is known to be on the board
+    char dest_type       = dest_on_board 
+        ? m_board.getCell(destination.x, destination.y) : '.';
+    bool dest_is_rock    = (dest_type == 'R');
+    bool dest_is_barrier = (dest_type == 'B');
 
-    // Check if destination is blocked by barrier
-    if (dest_on_board && moveIsBlocked(origin, destination))
-    {
-        dest_is_blocked = true;
-    }
+    // Check if destination is blocked by barrier; Only an L shaped move has 
+    // a path to check
+    bool dest_is_blocked = is_valid_shape && dest_on_board 
+        && moveIsBlocked(origin, destination);
 
     if (is_valid_shape && dest_on_board && !dest_is_rock && !dest_is_barrier
         && !dest_is_blocked)
     {
         tests_passed = true;
     }
-    else if (dest_on_board 
+    else if (dest_on_board && m_teleport_node_one && m_teleport_node_two
             && ((origin.number == m_teleport_node_one->number 
             && destination.number == m_teleport_node_two->number)
             || (origin.number == m_teleport_node_two->number 
@@ -375,19 +418,50 @@ bool MoveValidator::checkMove(Vertex origin, Vertex destination)
     return tests_passed;
 }
 
-/* Algorithm - Call validateMoves() to verify legality of move
+/* Algorithm - Call checkMove() to verify legality of move
+ * 
+ * Note      - The board is not marked and no move set is built, so the check
+ *             does not allocate memory
  * 
  */
-bool MoveValidator::isLegalMove(Vertex start, Vertex end)
+bool MoveValidator::isLegalMove(const Vertex &start, const Vertex &end)
 {
-    // Check legality of move
-    bool print_board = false;
-    std::vector<Vertex> move;
-    
-    move.push_back(start);
-    move.push_back(end);
-    
-    return (validateMoves(move, print_board));
+    return checkMove(start, end);
+}
+
+/* Algorithm - Build the start and end Vertex structs on the stack and call 
+ *             checkMove() to verify legality of move
+ * 
+ */
+bool MoveValidator::isLegalMove(int start_x, int start_y, int end_x, int end_y)
+{
+    Vertex start(start_x, start_y, m_board_row_size);
+    Vertex end(end_x, end_y, m_board_row_size);
+
+    return checkMove(start, end);
+}
+
+/* Algorithm - Return false for an empty move set, as validateMoves() does
+ *           - Call checkMove() for each pair of consecutive moves and return 
+ *             false at the first invalid move
+ * 
+ */
+bool MoveValidator::areLegalMoves(const std::vector<Vertex> &moves)
+{
+    if (moves.empty())
+    {
+        return false;
+    }
+
+    for (unsigned int i = 0; i + 1 < moves.size(); i++)
+    {
+        if (!checkMove(moves[i], moves[i + 1]))
+        {
+            return false;
+        }
+    }
+
+    return true;
 }
 
 /* Algorithm - Check if the move is blocked; The move is blocked if one of the
@@ -396,7 +470,7 @@ bool MoveValidator::isLegalMove(Vertex start, Vertex end)
  *             destination is a barrier
  * 
  */
-bool MoveValidator::moveIsBlocked(Vertex start, Vertex end)
+bool MoveValidator::moveIsBlocked(const Vertex &start, const Vertex &end)
 {
     bool move_is_blocked = false;
     int  horizontal_diff = 0;
@@ -409,7 +483,7 @@ bool MoveValidator::moveIsBlocked(Vertex start, Vertex end)
     if (abs(horizontal_diff) > abs(vertical_diff))
     {
         // Move is 2 nodes horizontal first
-        if (m_board[start.y][end.x] == 'B')
+        if (m_board.getCell(end.x, start.y) == 'B')
         {
             // Second horizontal node is a barrier
             move_is_blocked = true;
@@ -420,7 +494,7 @@ bool MoveValidator::moveIsBlocked(Vertex start, Vertex end)
             if (horizontal_diff < 0)
             {
                 // Move horizontal to left
-                if (m_board[start.y][start.x - 1] == 'B')
+                if (m_board.getCell(start.x - 1, start.y) == 'B')
                 {
                     // First horizontal node is a barrier
                     move_is_blocked = true;
@@ -429,7 +503,7 @@ bool MoveValidator::moveIsBlocked(Vertex start, Vertex end)
             else
             {
                 // Move is horizontal to right
-                if (m_board[start.y][start.x + 1] == 'B')
+                if (m_board.getCell(start.x + 1, start.y) == 'B')
                 {
                     // First horizontal node is a barrier
                     move_is_blocked = true;
@@ -440,7 +514,7 @@ bool MoveValidator::moveIsBlocked(Vertex start, Vertex end)
     else
     {
         // Move is 2 nodes vertical first
-        if (m_board[end.y][start.x] == 'B')
+        if (m_board.getCell(start.x, end.y) == 'B')
         {
             // Second vertical node is a barrier
             move_is_blocked = true;
@@ -451,7 +525,7 @@ bool MoveValidator::moveIsBlocked(Vertex start, Vertex end)
             if (vertical_diff < 0)
             {
                 // Move vertical up
-                if (m_board[start.y - 1][start.x] == 'B')
+                if (m_board.getCell(start.x, start.y - 1) == 'B')
                 {
                     // First vertical node is a barrier
                     move_is_blocked = true;
@@ -460,7 +534,7 @@ bool MoveValidator::moveIsBlocked(Vertex start, Vertex end)
             else
             {
                 // Move is vertical down
-                if (m_board[start.y + 1][start.x] == 'B')
+                if (m_board.getCell(start.x, start.y + 1) == 'B')
                 {
                     // First vertical node is a barrier
                     move_is_blocked = true;
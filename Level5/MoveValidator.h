@@ -3,21 +3,45 @@
 
 /*              Author: Michael Marven
  *        Date Created: 05/26/17
- *  Date Last Modified: 07/01/17
+ *  Date Last Modified: 10/17/26
  *
  */
 
 #include <vector>
 #include <iostream>
+#include <cstdint>
 
 #include "CommonDefs.h"
+#include "BoardView.h"
 
 class MoveValidator
 {
 public:
 
-    // Constructor
-    MoveValidator(std::vector<std::vector<char> > board);
+    // Constructors
+    MoveValidator(const std::vector<std::vector<char> > &board);
+
+    /* Brief desc.     - A constructor to validate moves on a board held by the
+     *                   caller
+     * param[in] board - View of the board
+     *
+     * Note            - The board is not copied; The viewed buffer must outlive
+     *                   the MoveValidator object
+     *
+     */
+    MoveValidator(const BoardView &board);
+
+    /* Brief desc.          - A constructor to validate moves on a board held
+     *                        by the caller, using legal move masks computed 
+     *                        earlier, such as those of a graph file
+     * param[in] board      - View of the board
+     * param[in] move_masks - Legal move mask of each node
+     *
+     * Note                 - Neither the board nor the masks are copied; Both
+     *                        must outlive the MoveValidator object
+     *
+     */
+    MoveValidator(const BoardView &board, const uint8_t *move_masks);
 
     // Destructor
     ~MoveValidator();
@@ -33,6 +57,37 @@ public:
      */
     bool validateMoves(std::vector<Vertex> moves, bool print_moves);
 
+    /* Brief desc.     - A method to validate a set of moves without printing 
+     *                   or marking the board
+     * param[in] moves - Vector of Vertex structs representing each move
+     *
+     * param[out]      - Returns true if all moves are valid, as 
+     *                   validateMoves() does
+     *
+     */
+    bool areLegalMoves(const std::vector<Vertex> &moves);
+
+    /* Brief desc.     - A method to check if a move is legal
+     * param[in] start - Starting node
+     * param[in] end   - Ending node
+     *
+     * param[out]      - True if the move was legal
+     *
+     */
+    bool isLegalMove(const Vertex &start, const Vertex &end);
+
+    /* Brief desc.       - A method to check if a move is legal from raw 
+     *                     coordinates
+     * param[in] start_x - X coordinate of the starting node
+     * param[in] start_y - Y coordinate of the starting node
+     * param[in] end_x   - X coordinate of the ending node
+     * param[in] end_y   - Y coordinate of the ending node
+     *
+     * param[out]        - True if the move was legal
+     *
+     */
+    bool isLegalMove(int start_x, int start_y, int end_x, int end_y);
+
     /* Brief desc.     - A method to return a set of legal moves from a position
      * param[in] start - Starting node
      *
@@ -42,6 +97,18 @@ public:
      */
     std::vector<Vertex> getLegalMoves(Vertex start);
 
+    /* Brief desc.      - A method to return the legal move mask of a position
+     * param[in] number - Number of the starting node
+     *
+     * param[out]       - Returns a mask with bit i set if the move in direction
+     *                    i (see KNIGHT_MOVE_X and KNIGHT_MOVE_Y) is legal
+     *
+     * Note             - The masks are computed once by the constructor and 
+     *                    reflect the board as it was given
+     *
+     */
+    uint8_t getLegalMoveMask(int number);
+
     /* Brief desc.        - A method to verify a position is on the board
      * param[in] position - Vertex representing the position needing checked
      *
@@ -76,29 +143,37 @@ public:
 
 private:
 
+    // Not copyable, as m_board and m_move_mask_data point into the object's 
+    // own buffers
+    MoveValidator(const MoveValidator &other);
+    MoveValidator &operator=(const MoveValidator &other);
+
     /* Brief desc.     - A method to print the board to stdout
-     * param[in] board - A 2D Vector of chars to represent the board
+     * param[in] board - View of the board to print
      *
      */
-    void printBoard(std::vector<std::vector<char> > board);
+    void printBoard(const BoardView &board);
 
-    /* Brief desc.           - A method to validate one move
-     * param[in] origin      - Vertex representing the starting position
-     * param[in] destination - Vertex representing the end position of the move
+    /* Brief desc. - A method to record the teleport nodes of the board in 
+     *               m_teleport_node_one and m_teleport_node_two
      *
-     * param[out]            - Returns true if the move is valid
+     */
+    void findTeleportNodes();
+
+    /* Brief desc. - A method to compute the legal move mask of every position
+     *               using checkMove() and store them in m_move_masks
      *
      */
-    bool checkMove(Vertex origin, Vertex destination);
+    void buildMoveMasks();
 
-    /* Brief desc.     - A method to check if a move is legal
-     * param[in] start - Starting node
-     * param[in] end   - Ending node
+    /* Brief desc.           - A method to validate one move
+     * param[in] origin      - Vertex representing the starting position
+     * param[in] destination - Vertex representing the end position of the move
      *
-     * param[out]      - True if the move was legal
+     * param[out]            - Returns true if the move is valid
      *
      */
-    bool isLegalMove(Vertex start, Vertex end);
+    bool checkMove(const Vertex &origin, const Vertex &destination);
 
     /* Brief desc.     - A method to check if a move is blocked by a barrier
      * param[in] start - Starting node
@@ -110,16 +185,31 @@ private:
      *                   barrier
      *
      */
-    bool moveIsBlocked(Vertex start, Vertex end);
+    bool moveIsBlocked(const Vertex &start, const Vertex &end);
 
     // Attributes
-    std::vector<std::vector<char> > m_board;
+
+    // Board buffer when constructed from rows; Empty when the board is held 
+    // by the caller
+    std::vector<char> m_board_cells;
+
+    BoardView m_board;
+
+    // Copy of the board that validateMoves() marks with the moves it prints; 
+    // Made on the first call that prints
+    std::vector<char> m_marked_cells;
 
     int m_board_row_size;
 
     Vertex *m_teleport_node_one;
     Vertex *m_teleport_node_two;
 
+    // One legal move mask per node, indexed by node number; m_move_mask_data
+    // points to m_move_masks, or to the masks given to the constructor
+    std::vector<uint8_t> m_move_masks;
+
+    const uint8_t *m_move_mask_data;
+
 };
 
 #endif // MOVE_VALIDATOR_H
\ No newline at end of file
@@ -0,0 +1,51 @@
+/*              Author: Michael Marven
+ *        Date Created: 10/17/26
+ *  Date Last Modified: 10/17/26
+ *
+ */
+
+#include <iostream>
+
+#include "BoardView.h"
+#include "BoardFile.h"
+
+int main(int argc, char *argv[])
+{
+    // Program to convert a board file between the text and binary formats; A 
+    // text board is written as binary and a binary board is written as text
+
+    if (argc != 3)
+    {
+        std::cout << "Usage: boardconv <input board file> <output board file>\n";
+        return 1;
+    }
+
+    BoardFile board_file;
+    if (!board_file.load(argv[1]))
+    {
+        return 1;
+    }
+
+    BoardView board = board_file.getBoard();
+    bool written = false;
+
+    if (board.isPacked())
+    {
+        written = BoardFile::writeTextBoard(board, argv[2]);
+    }
+    else
+    {
+        written = BoardFile::writeBinaryBoard(board, argv[2]);
+    }
+
+    if (!written)
+    {
+        std::cout << "Board file " << argv[2] << " could not be written.\n";
+        return 1;
+    }
+
+    std::cout << "Converted " << board.getRowSize() << " x " 
+        << board.getRowCount() << " board to " << argv[2] << "\n";
+
+    return 0;
+}
@@ -0,0 +1,53 @@
+/*              Author: Michael Marven
+ *        Date Created: 10/17/26
+ *  Date Last Modified: 10/17/26
+ *
+ */
+
+#include <iostream>
+#include <vector>
+#include <cstdlib>
+
+#include "KnightGraph.h"
+#include "BoardView.h"
+#include "BoardFile.h"
+
+int main(int argc, char *argv[])
+{
+    // Program to build the graph of a board file once and write it to a graph
+    // file, with a distance table from each hot start node given as an x y 
+    // pair
+
+    if (argc < 3 || argc % 2 != 1)
+    {
+        std::cout << "Usage: graphbuild <board file> <graph file> "
+            << "[start_x start_y ...]\n";
+        return 1;
+    }
+
+    BoardFile board_file;
+    if (!board_file.load(argv[1]))
+    {
+        return 1;
+    }
+
+    BoardView board = board_file.getBoard();
+    std::vector<Vertex> hot_starts;
+    for (int i = 3; i + 1 < argc; i += 2)
+    {
+        hot_starts.push_back(Vertex(atoi(argv[i]), atoi(argv[i + 1]), 
+            board.getRowSize()));
+    }
+
+    KnightGraph graph(board);
+    if (!graph.saveGraph(argv[2], hot_starts))
+    {
+        std::cout << "Graph file " << argv[2] << " could not be written.\n";
+        return 1;
+    }
+
+    std::cout << "Wrote " << board.getRowSize() << " x " 
+        << board.getRowCount() << " graph to " << argv[2] << "\n";
+
+    return 0;
+}
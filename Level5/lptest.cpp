@@ -1,15 +1,18 @@
 /*              Author: Michael Marven
  *        Date Created: 05/26/17
- *  Date Last Modified: 07/02/17
+ *  Date Last Modified: 10/17/26
  *
  */
 
 #include <vector>
 #include <iostream>
+#include <chrono>
 
 #include "CommonDefs.h"
 #include "MoveValidator.h"
 #include "KnightGraph.h"
+#include "BoardFile.h"
+#include "GraphFile.h"
 
 int main(int argc, char *argv[])
 {
@@ -94,8 +97,41 @@ int main(int argc, char *argv[])
     //       {'.', '.', '.', '.', '.', '.', '.', '.'},
     //       {'.', '.', '.', '.', '.', '.', '.', '.'} };
 
-    MoveValidator *validator = new MoveValidator(board);
-    KnightGraph   *graph     = new KnightGraph(board);
+    // Load the board from a text file instead if one is given, for example
+    // ./lptest board.txt; The file is mapped and not copied
+    // A graph file written by graphbuild or saveGraph() is used the same way,
+    // so the graph is not built again
+    BoardFile board_file;
+    GraphFile graph_file;
+    MoveValidator *validator = NULL;
+    KnightGraph   *graph     = NULL;
+
+    if (argc > 1 && GraphFile::isGraphFile(argv[1]))
+    {
+        if (!graph_file.load(argv[1], false))
+        {
+            return 1;
+        }
+
+        validator = new MoveValidator(graph_file.getBoard(), 
+            graph_file.getMoveMasks());
+        graph     = new KnightGraph(graph_file);
+    }
+    else if (argc > 1)
+    {
+        if (!board_file.load(argv[1]))
+        {
+            return 1;
+        }
+
+        validator = new MoveValidator(board_file.getBoard());
+        graph     = new KnightGraph(board_file.getBoard());
+    }
+    else
+    {
+        validator = new MoveValidator(board);
+        graph     = new KnightGraph(board);
+    }
 
     // int start_x = -1;
     // int start_y = 88;
@@ -108,9 +144,25 @@ int main(int argc, char *argv[])
 
     int searches = 100;
 
+    // graph->saveGraph("board.kgr", std::vector<Vertex>(1, 
+    //     Vertex(start_x, start_y, 32)));
     // graph->dfsGraphBuild(start_x, start_y);
     // graph->daShortestPath(start_x, start_y, end_x, end_y);
+    // graph->dialShortestPath(start_x, start_y, end_x, end_y);
+    // graph->astarShortestPath(start_x, start_y, end_x, end_y);
+    // graph->bidiShortestPath(start_x, start_y, end_x, end_y, true);
+    // graph->lazyShortestPath(start_x, start_y, end_x, end_y);
+    // graph->bitBfsShortestPath(start_x, start_y, end_x, end_y);
+    // graph->setRolloutPruning(true);
     graph->apprLongestPath(start_x, start_y, end_x, end_y, searches);
+    // graph->parApprLongestPath(start_x, start_y, end_x, end_y, searches, 0);
+    // graph->exactLongestPath(start_x, start_y, end_x, end_y, 10000000);
+    // graph->improveLongestPath(std::chrono::steady_clock::now() 
+    //     + std::chrono::milliseconds(200));
+    // graph->apprLongestPath(start_x, start_y, end_x, end_y, 
+    //     std::chrono::steady_clock::now() + std::chrono::seconds(1), 
+    //     [](int length, double percent)
+    //     { std::cout << length << " (" << percent << ")\n"; });
     
     std::vector<Vertex> moves = graph->getPathToEnd();
     
@@ -124,6 +176,33 @@ int main(int argc, char *argv[])
     // Best result with these coordinates (0,0) (27,6)
     // Path length - 722; Percntage - 63.7809%
 
+    // Time the exact solver on an 8 x 8 board with a teleport pair, rocks, 
+    // barriers, water and lava; It should prove the longest path in seconds
+    std::vector<std::vector<char> > exact_board = 
+        { {'R', 'W', '.', 'W', 'W', 'T', '.', '.'},
+          {'.', '.', '.', '.', 'B', '.', '.', '.'},
+          {'.', 'B', '.', '.', '.', '.', '.', '.'},
+          {'.', '.', 'W', '.', '.', '.', 'L', '.'},
+          {'.', '.', '.', 'W', '.', '.', 'L', '.'},
+          {'L', 'W', '.', 'B', '.', '.', '.', '.'},
+          {'.', '.', 'T', 'L', '.', 'B', '.', '.'},
+          {'.', '.', '.', '.', 'L', '.', '.', '.'} };
+
+    MoveValidator exact_validator(exact_board);
+    KnightGraph   exact_graph(exact_board);
+
+    std::chrono::steady_clock::time_point exact_start = 
+        std::chrono::steady_clock::now();
+    bool is_longest = exact_graph.exactLongestPath(0, 7, 2, 2, 100000000);
+    std::chrono::duration<double> exact_seconds = 
+        std::chrono::steady_clock::now() - exact_start;
+
+    std::vector<Vertex> exact_moves = exact_graph.getPathToEnd();
+    exact_validator.validateMoves(exact_moves, false);
+    exact_graph.printCalculatedPathLengthAndPercent();
+    std::cout << "Exact longest path " << (is_longest ? "proven" : "not proven")
+        << " in " << exact_seconds.count() << " seconds\n";
+
     // Delete pointers
     if (validator)
     {